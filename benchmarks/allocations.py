@@ -0,0 +1,89 @@
+"""Measure object churn in verify-heavy and keylist-heavy loops.
+
+Each iteration creates and drops the short-lived result wrappers
+(Signature, SigNotation, Subkey, UserId and KeySig) that are served
+from per-type free lists.  Run it against two builds to compare them:
+
+    PYTHONPATH=./src python3 benchmarks/allocations.py
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import timeit
+from io import BytesIO
+
+import gpgme
+
+KEYDIR = os.path.join(os.path.dirname(__file__), '..', 'tests', 'keys')
+FPR = 'E79A842DA34A1CA383F64A1546BB55F0885C65A4'
+
+
+def setup_home() -> str:
+    home = tempfile.mkdtemp(prefix='tmp.gpghome')
+    os.environ['GNUPGHOME'] = home
+    with open(os.path.join(home, 'gpg.conf'), 'w') as fp:
+        fp.write('pinentry-mode loopback\n')
+    ctx = gpgme.Context()
+    for name in ['key1.pub', 'key1.sec', 'key2.pub', 'revoked.pub',
+                 'signonly.pub']:
+        with open(os.path.join(KEYDIR, name), 'rb') as fp:
+            ctx.import_(fp)
+    return home
+
+
+def verify_loop(ctx: gpgme.Context, signature: bytes) -> None:
+    for sig in ctx.verify(BytesIO(signature), None, BytesIO()):
+        sig.fpr, sig.status, sig.notations
+
+
+def keylist_loop(ctx: gpgme.Context) -> None:
+    for key in ctx.keylist():
+        for subkey in key.subkeys:
+            subkey.keyid
+        for uid in key.uids:
+            for keysig in uid.signatures:
+                keysig.keyid
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=200,
+                        help='iterations per measurement')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of measurements')
+    args = parser.parse_args()
+
+    home = setup_home()
+    try:
+        ctx = gpgme.Context()
+        ctx.keylist_mode = gpgme.KeylistMode.LOCAL | gpgme.KeylistMode.SIGS
+        ctx.signers = [ctx.get_key(FPR)]
+        ctx.sig_notations = [gpgme.SigNotation('test@example.org', 'value')]
+        signature = BytesIO()
+        ctx.sign(BytesIO(b'Hello World\n'), signature, gpgme.SigMode.NORMAL)
+        signature = signature.getvalue()
+
+        cases = {
+            'verify': lambda: verify_loop(ctx, signature),
+            'keylist': lambda: keylist_loop(ctx),
+        }
+        for name, func in cases.items():
+            func()
+            blocks = sys.getallocatedblocks()
+            best = min(timeit.repeat(func, number=args.number,
+                                     repeat=args.repeat))
+            print('{:10s} {:10.1f} us/iter {:+8d} blocks'.format(
+                name, best / args.number * 1e6,
+                sys.getallocatedblocks() - blocks))
+    finally:
+        subprocess.call(['gpg-connect-agent', 'KILLAGENT', '/bye'],
+                        stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        shutil.rmtree(home, ignore_errors=True)
+
+
+if __name__ == '__main__':
+    main()
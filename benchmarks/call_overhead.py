@@ -0,0 +1,77 @@
+"""Measure the per-call overhead of common Context methods.
+
+The payloads are tiny, so the time is dominated by argument parsing,
+object creation and the round trip to gpg rather than by crypto.  Run
+it against two builds to compare them:
+
+    PYTHONPATH=./src python3 benchmarks/call_overhead.py
+
+Most of the calls timed here also run gpg, which takes milliseconds,
+so differences in argument handling alone may be within noise.
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import tempfile
+import timeit
+from io import BytesIO
+
+import gpgme
+
+KEYDIR = os.path.join(os.path.dirname(__file__), '..', 'tests', 'keys')
+FPR = 'E79A842DA34A1CA383F64A1546BB55F0885C65A4'
+
+
+def setup_home() -> str:
+    home = tempfile.mkdtemp(prefix='tmp.gpghome')
+    os.environ['GNUPGHOME'] = home
+    with open(os.path.join(home, 'gpg.conf'), 'w') as fp:
+        fp.write('pinentry-mode loopback\n')
+    ctx = gpgme.Context()
+    for name in ['key1.pub', 'key1.sec']:
+        with open(os.path.join(KEYDIR, name), 'rb') as fp:
+            ctx.import_(fp)
+    return home
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=200,
+                        help='calls per measurement')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of measurements')
+    args = parser.parse_args()
+
+    home = setup_home()
+    try:
+        ctx = gpgme.Context()
+        key = ctx.get_key(FPR)
+        ctx.signers = [key]
+        signature = BytesIO()
+        ctx.sign(BytesIO(b'Hello World\n'), signature, gpgme.SigMode.NORMAL)
+        signature = signature.getvalue()
+
+        cases = {
+            'get_key': lambda: ctx.get_key(FPR),
+            'get_key (keywords)': lambda: ctx.get_key(fingerprint=FPR),
+            'sign': lambda: ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                                     gpgme.SigMode.NORMAL),
+            'verify': lambda: ctx.verify(BytesIO(signature), None,
+                                         BytesIO()),
+            'verify_ok': lambda: ctx.verify_ok(BytesIO(signature)),
+        }
+        for name, func in cases.items():
+            best = min(timeit.repeat(func, number=args.number,
+                                     repeat=args.repeat))
+            print('{:20s} {:10.1f} us/call'.format(
+                name, best / args.number * 1e6))
+    finally:
+        subprocess.call(['gpg-connect-agent', 'KILLAGENT', '/bye'],
+                        stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        shutil.rmtree(home, ignore_errors=True)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,50 @@
+"""Measure the time taken to import gpgme in a fresh interpreter.
+
+The import is timed inside the new interpreter, so its own startup
+cost is not included.  The time to first use the enumerations is
+reported separately.  Run it against two
+builds to compare them:
+
+    PYTHONPATH=./src python3 benchmarks/import_time.py
+"""
+
+import argparse
+import subprocess
+import sys
+
+IMPORT = '''
+import time
+start = time.perf_counter()
+import gpgme
+middle = time.perf_counter()
+gpgme.Status, gpgme.ErrCode, gpgme.STATUS_EOF, gpgme.ERR_GENERAL
+end = time.perf_counter()
+print(middle - start, end - middle)
+'''
+
+
+def run(number: int) -> tuple[float, float]:
+    import_times = []
+    access_times = []
+    for i in range(number):
+        output = subprocess.check_output([sys.executable, '-c', IMPORT])
+        import_time, access_time = map(float, output.split())
+        import_times.append(import_time)
+        access_times.append(access_time)
+    return min(import_times), min(access_times)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=20,
+                        help='number of interpreters to start')
+    args = parser.parse_args()
+
+    import_time, access_time = run(args.number)
+    print('{:20s} {:10.2f} ms'.format('import gpgme', import_time * 1e3))
+    print('{:20s} {:10.2f} ms'.format('first enum access',
+                                      access_time * 1e3))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,120 @@
+"""Count the processes spawned while a fresh interpreter starts using gpgme.
+
+Each scenario runs in a new interpreter under strace, which must be
+installed, and every successful execve() other than the interpreter's
+own is counted.  The wall clock time of the scenario is reported too.
+gpgme's own search for gpg and gpgconf when the module is imported is
+counted in every scenario, as there is no way to skip it.
+Run it against two builds to compare them:
+
+    PYTHONPATH=./src python3 benchmarks/startup.py
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+import gpgme
+
+CONTEXTS = 10
+
+SCENARIOS = {
+    'first context': '''
+import gpgme
+gpgme.Context().get_engine_info()
+''',
+    'first context (preseeded)': '''
+import json, gpgme
+with open(SNAPSHOT) as fp:
+    gpgme.preseed_engine_info(json.load(fp))
+gpgme.Context().get_engine_info()
+''',
+    'contexts with set_engine_info': '''
+import gpgme
+for i in range(CONTEXTS):
+    ctx = gpgme.Context()
+    ctx.set_engine_info(gpgme.Protocol.OpenPGP, None, HOME)
+''',
+    'contexts (preseeded home)': '''
+import json, gpgme
+with open(SNAPSHOT) as fp:
+    snapshot = json.load(fp)
+for entry in snapshot:
+    if entry[0] == gpgme.Protocol.OpenPGP:
+        entry[2] = HOME
+gpgme.preseed_engine_info(snapshot)
+for i in range(CONTEXTS):
+    ctx = gpgme.Context()
+''',
+}
+
+PRELUDE = '''
+import time
+SNAPSHOT = {snapshot!r}
+HOME = {home!r}
+CONTEXTS = {contexts!r}
+start = time.perf_counter()
+'''
+
+EPILOGUE = '''
+print(time.perf_counter() - start)
+'''
+
+
+def count_execs(log: str) -> int:
+    count = 0
+    with open(log) as fp:
+        for line in fp:
+            if 'execve(' in line and '= -1' not in line:
+                count += 1
+    # the first is the interpreter itself
+    return count - 1
+
+
+def run(code: str, workdir: str, number: int) -> tuple[int, float]:
+    log = os.path.join(workdir, 'strace.log')
+    spawned = []
+    times = []
+    for i in range(number):
+        output = subprocess.check_output(
+            ['strace', '-f', '-qq', '-e', 'trace=execve', '-o', log,
+             sys.executable, '-c', code])
+        spawned.append(count_execs(log))
+        times.append(float(output.split()[-1]))
+    return max(spawned), min(times)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=5,
+                        help='interpreters to start per scenario')
+    args = parser.parse_args()
+
+    if shutil.which('strace') is None:
+        sys.exit('strace is needed to count spawned processes')
+
+    workdir = tempfile.mkdtemp(prefix='tmp.startup')
+    home = os.path.join(workdir, 'gnupg')
+    os.mkdir(home, 0o700)
+    try:
+        snapshot = os.path.join(workdir, 'engines.json')
+        with open(snapshot, 'w') as fp:
+            json.dump(gpgme.engine_info_snapshot(), fp)
+
+        prelude = PRELUDE.format(snapshot=snapshot, home=home,
+                                 contexts=CONTEXTS)
+        for name, code in SCENARIOS.items():
+            spawned, elapsed = run(prelude + code + EPILOGUE, workdir,
+                                   args.number)
+            print('{:32s} {:4d} processes {:10.2f} ms'.format(
+                name, spawned, elapsed * 1e3))
+    finally:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+
+if __name__ == '__main__':
+    main()
@@ -30,6 +30,149 @@ pygpgme_no_constructor(PyObject *self, PyObject *args, PyObject *kwargs)
     return -1;
 }
 
+/* Matches the arguments of a METH_FASTCALL | METH_KEYWORDS call
+ * against the NULL terminated list of parameter names.  values[i] is
+ * set to a borrowed reference to the argument for kwlist[i], or NULL
+ * if it was not supplied.  The first n_required parameters must be
+ * given, and only the first n_positional may be given positionally. */
+int
+pygpgme_parse_args(const char *fname, PyObject *const *args,
+                   Py_ssize_t nargs, PyObject *kwnames,
+                   const char *const *kwlist, Py_ssize_t n_required,
+                   Py_ssize_t n_positional, PyObject **values)
+{
+    Py_ssize_t n_params, n_kwargs, i, j;
+
+    for (n_params = 0; kwlist[n_params] != NULL; n_params++)
+        values[n_params] = NULL;
+
+    if (nargs > n_positional) {
+        PyErr_Format(PyExc_TypeError,
+                     "%s() takes at most %zd positional arguments "
+                     "(%zd given)", fname, n_positional, nargs);
+        return -1;
+    }
+    for (i = 0; i < nargs; i++)
+        values[i] = args[i];
+
+    n_kwargs = kwnames != NULL ? PyTuple_GET_SIZE(kwnames) : 0;
+    for (i = 0; i < n_kwargs; i++) {
+        PyObject *name = PyTuple_GET_ITEM(kwnames, i);
+
+        for (j = 0; j < n_params; j++) {
+            if (PyUnicode_CompareWithASCIIString(name, kwlist[j]) == 0)
+                break;
+        }
+        if (j == n_params) {
+            PyErr_Format(PyExc_TypeError,
+                         "%s() got an unexpected keyword argument '%U'",
+                         fname, name);
+            return -1;
+        }
+        if (values[j] != NULL) {
+            PyErr_Format(PyExc_TypeError,
+                         "%s() got multiple values for argument '%s'",
+                         fname, kwlist[j]);
+            return -1;
+        }
+        values[j] = args[nargs + i];
+    }
+
+    for (i = 0; i < n_required; i++) {
+        if (values[i] == NULL) {
+            PyErr_Format(PyExc_TypeError,
+                         "%s() missing required argument '%s' (pos %zd)",
+                         fname, kwlist[i], i + 1);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Returns the object cached in *slot, creating it with make() on
+ * first access.  Used for attributes that are expensive to build and
+ * often not looked at. */
+PyObject *
+pygpgme_get_cached(PyObject *self, PyObject **slot,
+                   PyObject *(*make)(PyObject *self))
+{
+    PyObject *value, *unused = NULL;
+
+    PYGPGME_BEGIN_CRITICAL_SECTION(self);
+    value = *slot;
+    Py_XINCREF(value);
+    PYGPGME_END_CRITICAL_SECTION();
+    if (value != NULL)
+        return value;
+
+    value = make(self);
+    if (value == NULL)
+        return NULL;
+
+    /* another thread may have got here first */
+    PYGPGME_BEGIN_CRITICAL_SECTION(self);
+    if (*slot == NULL) {
+        Py_INCREF(value);
+        *slot = value;
+    } else {
+        unused = value;
+        value = *slot;
+        Py_INCREF(value);
+    }
+    PYGPGME_END_CRITICAL_SECTION();
+    Py_XDECREF(unused);
+    return value;
+}
+
+#define FREE_LIST_NEXT(obj) (*(PyObject **)((char *)(obj) + sizeof(PyObject)))
+
+/* Returns a new instance of type, reusing the memory of a previously
+ * released instance if one is available.  As with PyObject_New(),
+ * only the object header is initialised. */
+PyObject *
+pygpgme_free_list_alloc(PyGpgmeFreeList *list, PyTypeObject *type)
+{
+#ifndef Py_GIL_DISABLED
+    PyObject *obj = list->head;
+
+    if (obj != NULL) {
+        list->head = FREE_LIST_NEXT(obj);
+        list->count--;
+        return PyObject_Init(obj, type);
+    }
+#endif
+    return PyObject_New(PyObject, type);
+}
+
+/* Called from tp_dealloc in place of PyObject_Del() once the object's
+ * fields have been released. */
+void
+pygpgme_free_list_release(PyGpgmeFreeList *list, PyObject *obj)
+{
+#ifndef Py_GIL_DISABLED
+    if (!list->closed && list->count < PYGPGME_FREE_LIST_SIZE) {
+        FREE_LIST_NEXT(obj) = list->head;
+        list->head = obj;
+        list->count++;
+        return;
+    }
+#endif
+    PyObject_Del(obj);
+}
+
+void
+pygpgme_free_list_clear(PyGpgmeFreeList *list)
+{
+    while (list->head != NULL) {
+        PyObject *obj = list->head;
+
+        list->head = FREE_LIST_NEXT(obj);
+        PyObject_Del(obj);
+    }
+    list->count = 0;
+    list->closed = 1;
+}
+
 static int
 pygpgme_mod_exec(PyObject *mod) {
     PyGpgmeModState *state = PyModule_GetState(mod);
@@ -40,6 +183,19 @@ pygpgme_mod_exec(PyObject *mod) {
     Py_INCREF(state->pygpgme_error);
     PyModule_AddObject(mod, "GpgmeError", state->pygpgme_error);
 
+    state->strerror_cache = PyDict_New();
+    if (!state->strerror_cache)
+        return -1;
+    state->str_source = PyUnicode_InternFromString("source");
+    state->str_code = PyUnicode_InternFromString("code");
+    state->str_strerror = PyUnicode_InternFromString("strerror");
+    if (!state->str_source || !state->str_code || !state->str_strerror)
+        return -1;
+    if (pygpgme_intern_init(state) < 0)
+        return -1;
+    if (pygpgme_fork_init(state, mod) < 0)
+        return -1;
+
 #define INIT_TYPE(type, spec) \
     state->type##_Type = (PyTypeObject *)PyType_FromModuleAndSpec(mod, spec, NULL); \
     if (!state->type##_Type) \
@@ -59,8 +215,19 @@ pygpgme_mod_exec(PyObject *mod) {
     INIT_TYPE(SigNotation, &pygpgme_sig_notation_spec);
     INIT_TYPE(ImportResult, &pygpgme_import_result_spec);
     INIT_TYPE(GenkeyResult, &pygpgme_genkey_result_spec);
+    INIT_TYPE(DecryptResult, &pygpgme_decrypt_result_spec);
+    INIT_TYPE(RecipientSet, &pygpgme_recipient_set_spec);
+    INIT_TYPE(AgentConnection, &pygpgme_agent_connection_spec);
+
+    state->VerifyVerdict_Type = PyStructSequence_NewType(
+        &pygpgme_verify_verdict_desc);
+    if (!state->VerifyVerdict_Type)
+        return -1;
+    Py_INCREF(state->VerifyVerdict_Type);
+    PyModule_AddObject(mod, "VerifyVerdict",
+                       (PyObject *)state->VerifyVerdict_Type);
 
-    pygpgme_add_constants(mod);
+    pygpgme_init_enums(state);
 
     gpgme_version = gpgme_check_version(NULL);
     PyModule_AddObject(mod, "gpgme_version",
@@ -75,6 +242,13 @@ pygpgme_mod_traverse(PyObject *mod, visitproc visit, void *arg)
 {
     PyGpgmeModState *state = PyModule_GetState(mod);
 
+#define VISIT_ENUM(name)                                                \
+    do {                                                                \
+        int vret = pygpgme_enum_traverse(&state->name, visit, arg);     \
+        if (vret)                                                       \
+            return vret;                                                \
+    } while (0)
+
     Py_VISIT(state->Context_Type);
     Py_VISIT(state->EngineInfo_Type);
     Py_VISIT(state->Key_Type);
@@ -87,26 +261,32 @@ pygpgme_mod_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->SigNotation_Type);
     Py_VISIT(state->ImportResult_Type);
     Py_VISIT(state->GenkeyResult_Type);
+    Py_VISIT(state->DecryptResult_Type);
+    Py_VISIT(state->RecipientSet_Type);
+    Py_VISIT(state->AgentConnection_Type);
+    Py_VISIT(state->VerifyVerdict_Type);
 
-    Py_VISIT(state->DataEncoding_Type);
-    Py_VISIT(state->PubkeyAlgo_Type);
-    Py_VISIT(state->HashAlgo_Type);
-    Py_VISIT(state->SigMode_Type);
-    Py_VISIT(state->Validity_Type);
-    Py_VISIT(state->Protocol_Type);
-    Py_VISIT(state->KeylistMode_Type);
-    Py_VISIT(state->PinentryMode_Type);
-    Py_VISIT(state->ExportMode_Type);
-    Py_VISIT(state->SigNotationFlags_Type);
-    Py_VISIT(state->Status_Type);
-    Py_VISIT(state->EncryptFlags_Type);
-    Py_VISIT(state->Sigsum_Type);
-    Py_VISIT(state->Import_Type);
-    Py_VISIT(state->Delete_Type);
-    Py_VISIT(state->ErrSource_Type);
-    Py_VISIT(state->ErrCode_Type);
+    VISIT_ENUM(DataEncoding);
+    VISIT_ENUM(PubkeyAlgo);
+    VISIT_ENUM(HashAlgo);
+    VISIT_ENUM(SigMode);
+    VISIT_ENUM(Validity);
+    VISIT_ENUM(Protocol);
+    VISIT_ENUM(KeylistMode);
+    VISIT_ENUM(PinentryMode);
+    VISIT_ENUM(ExportMode);
+    VISIT_ENUM(SigNotationFlags);
+    VISIT_ENUM(Status);
+    VISIT_ENUM(EncryptFlags);
+    VISIT_ENUM(Sigsum);
+    VISIT_ENUM(Import);
+    VISIT_ENUM(Delete);
+    VISIT_ENUM(KeyFlags);
+    VISIT_ENUM(ErrSource);
+    VISIT_ENUM(ErrCode);
 
     Py_VISIT(state->pygpgme_error);
+    Py_VISIT(state->strerror_cache);
     return 0;
 }
 
@@ -127,26 +307,43 @@ pygpgme_mod_clear(PyObject *mod)
     Py_CLEAR(state->SigNotation_Type);
     Py_CLEAR(state->ImportResult_Type);
     Py_CLEAR(state->GenkeyResult_Type);
+    Py_CLEAR(state->DecryptResult_Type);
+    Py_CLEAR(state->RecipientSet_Type);
+    Py_CLEAR(state->AgentConnection_Type);
+    Py_CLEAR(state->VerifyVerdict_Type);
 
-    Py_CLEAR(state->DataEncoding_Type);
-    Py_CLEAR(state->PubkeyAlgo_Type);
-    Py_CLEAR(state->HashAlgo_Type);
-    Py_CLEAR(state->SigMode_Type);
-    Py_CLEAR(state->Validity_Type);
-    Py_CLEAR(state->Protocol_Type);
-    Py_CLEAR(state->KeylistMode_Type);
-    Py_CLEAR(state->PinentryMode_Type);
-    Py_CLEAR(state->ExportMode_Type);
-    Py_CLEAR(state->SigNotationFlags_Type);
-    Py_CLEAR(state->Status_Type);
-    Py_CLEAR(state->EncryptFlags_Type);
-    Py_CLEAR(state->Sigsum_Type);
-    Py_CLEAR(state->Import_Type);
-    Py_CLEAR(state->Delete_Type);
-    Py_CLEAR(state->ErrSource_Type);
-    Py_CLEAR(state->ErrCode_Type);
+    pygpgme_enum_clear(&state->DataEncoding);
+    pygpgme_enum_clear(&state->PubkeyAlgo);
+    pygpgme_enum_clear(&state->HashAlgo);
+    pygpgme_enum_clear(&state->SigMode);
+    pygpgme_enum_clear(&state->Validity);
+    pygpgme_enum_clear(&state->Protocol);
+    pygpgme_enum_clear(&state->KeylistMode);
+    pygpgme_enum_clear(&state->PinentryMode);
+    pygpgme_enum_clear(&state->ExportMode);
+    pygpgme_enum_clear(&state->SigNotationFlags);
+    pygpgme_enum_clear(&state->Status);
+    pygpgme_enum_clear(&state->EncryptFlags);
+    pygpgme_enum_clear(&state->Sigsum);
+    pygpgme_enum_clear(&state->Import);
+    pygpgme_enum_clear(&state->Delete);
+    pygpgme_enum_clear(&state->KeyFlags);
+    pygpgme_enum_clear(&state->ErrSource);
+    pygpgme_enum_clear(&state->ErrCode);
 
     Py_CLEAR(state->pygpgme_error);
+    Py_CLEAR(state->strerror_cache);
+    Py_CLEAR(state->str_source);
+    Py_CLEAR(state->str_code);
+    Py_CLEAR(state->str_strerror);
+    pygpgme_intern_clear(state);
+
+    pygpgme_free_list_clear(&state->Subkey_free);
+    pygpgme_free_list_clear(&state->UserId_free);
+    pygpgme_free_list_clear(&state->KeySig_free);
+    pygpgme_free_list_clear(&state->NewSignature_free);
+    pygpgme_free_list_clear(&state->Signature_free);
+    pygpgme_free_list_clear(&state->SigNotation_free);
     return 0;
 }
 
@@ -157,6 +354,14 @@ pygpgme_mod_free(PyObject *mod)
 }
 
 static PyMethodDef pygpgme_mod_functions[] = {
+    { "__getattr__", (PyCFunction)pygpgme_mod_getattr, METH_O },
+    { "__dir__", (PyCFunction)pygpgme_mod_dir, METH_NOARGS },
+    { "engine_info_snapshot", (PyCFunction)pygpgme_engine_info_snapshot,
+      METH_NOARGS, pygpgme_engine_info_snapshot_doc },
+    { "preseed_engine_info", (PyCFunction)pygpgme_preseed_engine_info,
+      METH_O, pygpgme_preseed_engine_info_doc },
+    { "after_fork", (PyCFunction)pygpgme_after_fork, METH_NOARGS,
+      pygpgme_after_fork_doc },
     { NULL, NULL, 0 },
 };
 
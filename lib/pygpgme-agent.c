@@ -0,0 +1,624 @@
+/* -*- mode: C; c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/*
+    pygpgme - a Python wrapper for the gpgme library
+    Copyright (C) 2006  James Henstridge
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "pygpgme.h"
+
+#define KEYGRIP_LENGTH 40
+
+struct agent_status {
+    char *keyword;
+    char *args;
+};
+
+/* Data and status lines sent by the agent in reply to a command.
+ * This is filled in without the GIL, so only uses raw allocations. */
+struct agent_reply {
+    char *data;
+    size_t data_len;
+    size_t data_alloc;
+    struct agent_status *statuses;
+    Py_ssize_t n_statuses;
+    Py_ssize_t statuses_alloc;
+};
+
+static char *
+raw_strdup(const char *str)
+{
+    size_t length;
+    char *copy;
+
+    if (str == NULL)
+        return NULL;
+    length = strlen(str) + 1;
+    copy = PyMem_RawMalloc(length);
+    if (copy != NULL)
+        memcpy(copy, str, length);
+    return copy;
+}
+
+static void
+agent_reply_clear(struct agent_reply *reply)
+{
+    Py_ssize_t i;
+
+    if (reply->data != NULL) {
+        pygpgme_wipe(reply->data, reply->data_alloc);
+        PyMem_RawFree(reply->data);
+    }
+    for (i = 0; i < reply->n_statuses; i++) {
+        PyMem_RawFree(reply->statuses[i].keyword);
+        PyMem_RawFree(reply->statuses[i].args);
+    }
+    PyMem_RawFree(reply->statuses);
+    memset(reply, 0, sizeof(*reply));
+}
+
+static gpgme_error_t
+agent_data_cb(void *opaque, const void *data, size_t datalen)
+{
+    struct agent_reply *reply = opaque;
+
+    if (reply->data_len + datalen > reply->data_alloc) {
+        size_t alloc = reply->data_alloc ? reply->data_alloc : 256;
+        char *buffer;
+
+        while (alloc < reply->data_len + datalen)
+            alloc *= 2;
+        /* not realloc, so that nothing is left behind unwiped */
+        buffer = PyMem_RawMalloc(alloc);
+        if (buffer == NULL)
+            return gpgme_error(GPG_ERR_ENOMEM);
+        if (reply->data != NULL) {
+            memcpy(buffer, reply->data, reply->data_len);
+            pygpgme_wipe(reply->data, reply->data_alloc);
+            PyMem_RawFree(reply->data);
+        }
+        reply->data = buffer;
+        reply->data_alloc = alloc;
+    }
+    memcpy(reply->data + reply->data_len, data, datalen);
+    reply->data_len += datalen;
+    return 0;
+}
+
+static gpgme_error_t
+agent_status_cb(void *opaque, const char *status, const char *args)
+{
+    struct agent_reply *reply = opaque;
+    struct agent_status *entry;
+
+    if (reply->n_statuses == reply->statuses_alloc) {
+        Py_ssize_t alloc = reply->statuses_alloc ? reply->statuses_alloc * 2 : 4;
+        struct agent_status *statuses;
+
+        statuses = PyMem_RawRealloc(reply->statuses, alloc * sizeof(*statuses));
+        if (statuses == NULL)
+            return gpgme_error(GPG_ERR_ENOMEM);
+        reply->statuses = statuses;
+        reply->statuses_alloc = alloc;
+    }
+    entry = &reply->statuses[reply->n_statuses];
+    entry->keyword = raw_strdup(status);
+    entry->args = (args != NULL && args[0] != '\0') ? raw_strdup(args) : NULL;
+    if (entry->keyword == NULL ||
+        (args != NULL && args[0] != '\0' && entry->args == NULL)) {
+        PyMem_RawFree(entry->keyword);
+        PyMem_RawFree(entry->args);
+        return gpgme_error(GPG_ERR_ENOMEM);
+    }
+    reply->n_statuses++;
+    return 0;
+}
+
+/* Sends a single command to the agent and collects its reply.  The
+ * GIL is released while waiting, so the reply must not be touched by
+ * anything else until this returns. */
+static int
+agent_command(PyGpgmeAgentConnection *self, const char *command,
+              struct agent_reply *reply)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    gpgme_error_t err, op_err = 0;
+
+    if (strpbrk(command, "\r\n") != NULL) {
+        PyErr_SetString(PyExc_ValueError,
+                        "command must be a single line");
+        return -1;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    PyThread_acquire_lock(self->mutex, WAIT_LOCK);
+    /* inquiries from the agent are refused */
+    err = gpgme_op_assuan_transact_ext(self->ctx, command,
+                                       agent_data_cb, reply,
+                                       NULL, NULL,
+                                       agent_status_cb, reply, &op_err);
+    PyThread_release_lock(self->mutex);
+    Py_END_ALLOW_THREADS;
+
+    if (pygpgme_check_error(state, err) || pygpgme_check_error(state, op_err)) {
+        agent_reply_clear(reply);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+check_keygrip(const char *keygrip)
+{
+    size_t i;
+
+    for (i = 0; i < KEYGRIP_LENGTH; i++) {
+        if (!Py_ISXDIGIT(keygrip[i]))
+            break;
+    }
+    if (i != KEYGRIP_LENGTH || keygrip[i] != '\0') {
+        PyErr_SetString(PyExc_ValueError,
+                        "keygrip must be 40 hexadecimal digits");
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *
+decode_field(const char *str, size_t length)
+{
+    if (str == NULL || (length == 1 && str[0] == '-'))
+        Py_RETURN_NONE;
+    return PyUnicode_DecodeUTF8(str, length, "replace");
+}
+
+/* Creates a gpgme context connected to the agent's socket, or the
+ * default one if socket is NULL. */
+static gpgme_error_t
+agent_connect(gpgme_ctx_t *ctx, const char *socket)
+{
+    gpgme_error_t err;
+
+    err = gpgme_new(ctx);
+    if (err)
+        return err;
+    err = gpgme_set_protocol(*ctx, GPGME_PROTOCOL_ASSUAN);
+    if (!err && socket != NULL)
+        err = gpgme_ctx_set_engine_info(*ctx, GPGME_PROTOCOL_ASSUAN,
+                                        socket, NULL);
+    if (err) {
+        gpgme_release(*ctx);
+        *ctx = NULL;
+    }
+    return err;
+}
+
+/* Gives a connection created before fork() its own connection to the
+ * agent in the child.  The old context is abandoned rather than
+ * released, as releasing it would close the parent's session.  See
+ * pygpgme-fork.c. */
+int
+pygpgme_agent_connection_after_fork(PyGpgmeAgentConnection *self)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    gpgme_engine_info_t info;
+    gpgme_ctx_t ctx;
+
+    if (pygpgme_fork_reset_lock(&self->mutex) < 0)
+        return -1;
+    for (info = gpgme_ctx_get_engine_info(self->ctx); info != NULL;
+         info = info->next) {
+        if (info->protocol == GPGME_PROTOCOL_ASSUAN)
+            break;
+    }
+    if (pygpgme_check_error(state, agent_connect(
+            &ctx, info != NULL ? info->file_name : NULL)))
+        return -1;
+    self->ctx = ctx;
+    return 0;
+}
+
+static void
+pygpgme_agent_connection_dealloc(PyGpgmeAgentConnection *self)
+{
+    pygpgme_fork_untrack(PyType_GetModuleState(Py_TYPE(self)),
+                         &self->fork_link);
+    if (self->ctx)
+        gpgme_release(self->ctx);
+    self->ctx = NULL;
+    if (self->mutex)
+        PyThread_free_lock(self->mutex);
+    self->mutex = NULL;
+    PyObject_Del(self);
+}
+
+static PyObject *
+pygpgme_agent_connection_new(PyTypeObject *type, PyObject *args,
+                             PyObject *kwargs)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(type);
+    static char *kwlist[] = { "socket", NULL };
+    PyGpgmeAgentConnection *self;
+    const char *socket = NULL;
+    gpgme_error_t err;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|z", kwlist, &socket))
+        return NULL;
+
+    self = (PyGpgmeAgentConnection *)type->tp_alloc(type, 0);
+    if (self == NULL)
+        return NULL;
+
+    self->mutex = PyThread_allocate_lock();
+    if (self->mutex == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+
+    err = agent_connect(&self->ctx, socket);
+    if (pygpgme_check_error(state, err))
+        goto error;
+    pygpgme_fork_track(state, &self->fork_link, (PyObject *)self);
+
+    return (PyObject *)self;
+
+ error:
+    Py_DECREF(self);
+    return NULL;
+}
+
+static const char pygpgme_agent_connection_transact_doc[] =
+    "transact($self, command)\n"
+    "--\n\n"
+    "Send a raw Assuan command to the agent.\n"
+    "\n"
+    "Inquiries from the agent are refused, so commands that need them\n"
+    "will fail.\n"
+    "\n"
+    "Args:\n"
+    "  command (str): the command line to send.\n"
+    "\n"
+    "Returns:\n"
+    "  tuple[bytes, list[tuple[str, str | None]]]: the data sent by the\n"
+    "  agent, and the keyword and arguments of each status line.\n"
+    "\n"
+    "Raises:\n"
+    "  GpgmeError: if the agent could not be reached or the command failed.\n";
+
+static PyObject *
+pygpgme_agent_connection_transact(PyGpgmeAgentConnection *self, PyObject *args)
+{
+    struct agent_reply reply = { 0 };
+    const char *command;
+    PyObject *data = NULL, *statuses = NULL, *ret = NULL;
+    Py_ssize_t i;
+
+    if (!PyArg_ParseTuple(args, "s", &command))
+        return NULL;
+
+    if (agent_command(self, command, &reply) < 0)
+        return NULL;
+
+    data = PyBytes_FromStringAndSize(reply.data, reply.data_len);
+    if (data == NULL)
+        goto end;
+    statuses = PyList_New(reply.n_statuses);
+    if (statuses == NULL)
+        goto end;
+    for (i = 0; i < reply.n_statuses; i++) {
+        const char *status_args = reply.statuses[i].args;
+        PyObject *item;
+
+        item = Py_BuildValue("(sz)", reply.statuses[i].keyword, status_args);
+        if (item == NULL)
+            goto end;
+        PyList_SET_ITEM(statuses, i, item);
+    }
+    ret = PyTuple_Pack(2, data, statuses);
+
+ end:
+    Py_XDECREF(data);
+    Py_XDECREF(statuses);
+    agent_reply_clear(&reply);
+    return ret;
+}
+
+static const char pygpgme_agent_connection_preset_passphrase_doc[] =
+    "preset_passphrase($self, keygrip, passphrase, timeout=-1)\n"
+    "--\n\n"
+    "Store a passphrase in the agent's cache.\n"
+    "\n"
+    "Later operations using the key do not need to ask for its\n"
+    "passphrase.  The agent only accepts this if it was started with\n"
+    "the ``allow-preset-passphrase`` option.\n"
+    "\n"
+    "Args:\n"
+    "  keygrip (str): the keygrip of the (sub)key, as given by\n"
+    "    :attr:`Subkey.keygrip`.\n"
+    "  passphrase (str | bytes): the passphrase of the key.\n"
+    "  timeout (int): seconds until the entry expires, or -1 to keep it\n"
+    "    until it is cleared.\n"
+    "\n"
+    "Raises:\n"
+    "  GpgmeError: if the agent refused the passphrase.\n";
+
+static PyObject *
+pygpgme_agent_connection_preset_passphrase(PyGpgmeAgentConnection *self,
+                                           PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = { "keygrip", "passphrase", "timeout", NULL };
+    static const char hex[] = "0123456789ABCDEF";
+    struct agent_reply reply = { 0 };
+    const char *keygrip, *passphrase;
+    Py_ssize_t passphrase_len, i;
+    int timeout = -1, result;
+    char *command, *p;
+    size_t length;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ss#|i", kwlist,
+                                     &keygrip, &passphrase, &passphrase_len,
+                                     &timeout))
+        return NULL;
+
+    if (check_keygrip(keygrip) < 0)
+        return NULL;
+    if (timeout < -1) {
+        PyErr_SetString(PyExc_ValueError, "timeout must be -1 or greater");
+        return NULL;
+    }
+    if (passphrase_len == 0) {
+        PyErr_SetString(PyExc_ValueError, "passphrase must not be empty");
+        return NULL;
+    }
+
+    /* "PRESET_PASSPHRASE <keygrip> <timeout> <hex passphrase>" */
+    length = 18 + KEYGRIP_LENGTH + 1 + 12 + 1 + 2 * (size_t)passphrase_len + 1;
+    command = PyMem_Malloc(length);
+    if (command == NULL)
+        return PyErr_NoMemory();
+    p = command + PyOS_snprintf(command, length, "PRESET_PASSPHRASE %s %d ",
+                                keygrip, timeout);
+    for (i = 0; i < passphrase_len; i++) {
+        unsigned char c = passphrase[i];
+
+        *p++ = hex[c >> 4];
+        *p++ = hex[c & 0xf];
+    }
+    *p = '\0';
+
+    result = agent_command(self, command, &reply);
+    pygpgme_wipe(command, length);
+    PyMem_Free(command);
+    if (result < 0)
+        return NULL;
+    agent_reply_clear(&reply);
+
+    Py_RETURN_NONE;
+}
+
+static const char pygpgme_agent_connection_clear_passphrase_doc[] =
+    "clear_passphrase($self, keygrip)\n"
+    "--\n\n"
+    "Remove a key's passphrase from the agent's cache.\n"
+    "\n"
+    "Args:\n"
+    "  keygrip (str): the keygrip of the (sub)key.\n"
+    "\n"
+    "Raises:\n"
+    "  GpgmeError: if the command failed.\n";
+
+static PyObject *
+pygpgme_agent_connection_clear_passphrase(PyGpgmeAgentConnection *self,
+                                          PyObject *args)
+{
+    struct agent_reply reply = { 0 };
+    char command[64];
+    const char *keygrip;
+
+    if (!PyArg_ParseTuple(args, "s", &keygrip))
+        return NULL;
+    if (check_keygrip(keygrip) < 0)
+        return NULL;
+
+    PyOS_snprintf(command, sizeof(command),
+                  "CLEAR_PASSPHRASE --mode=normal %s", keygrip);
+    if (agent_command(self, command, &reply) < 0)
+        return NULL;
+    agent_reply_clear(&reply);
+
+    Py_RETURN_NONE;
+}
+
+/* fields of a KEYINFO status line, in order */
+static const char *const keyinfo_fields[] = {
+    "keygrip", "type", "serialno", "idstr", "cached", "protection",
+    "fpr", "ttl", "flags",
+};
+#define N_KEYINFO_FIELDS (sizeof(keyinfo_fields) / sizeof(keyinfo_fields[0]))
+
+static const char pygpgme_agent_connection_keyinfo_doc[] =
+    "keyinfo($self, keygrip)\n"
+    "--\n\n"
+    "Get information about a secret key held by the agent.\n"
+    "\n"
+    "Args:\n"
+    "  keygrip (str): the keygrip of the (sub)key.\n"
+    "\n"
+    "Returns:\n"
+    "  dict[str, str | bool | None]: the ``keygrip``, ``type``,\n"
+    "  ``serialno``, ``idstr``, ``cached``, ``protection``, ``fpr``,\n"
+    "  ``ttl`` and ``flags`` fields reported by the agent.  ``cached``\n"
+    "  is true if the passphrase is in the cache, and fields the agent\n"
+    "  left empty are None.\n"
+    "\n"
+    "Raises:\n"
+    "  GpgmeError: if the agent does not have the key.\n";
+
+static PyObject *
+pygpgme_agent_connection_keyinfo(PyGpgmeAgentConnection *self, PyObject *args)
+{
+    struct agent_reply reply = { 0 };
+    char command[64];
+    const char *keygrip, *line = NULL, *p;
+    PyObject *info = NULL;
+    Py_ssize_t i;
+    size_t field;
+
+    if (!PyArg_ParseTuple(args, "s", &keygrip))
+        return NULL;
+    if (check_keygrip(keygrip) < 0)
+        return NULL;
+
+    PyOS_snprintf(command, sizeof(command), "KEYINFO %s", keygrip);
+    if (agent_command(self, command, &reply) < 0)
+        return NULL;
+
+    for (i = 0; i < reply.n_statuses; i++) {
+        if (strcmp(reply.statuses[i].keyword, "KEYINFO") == 0) {
+            line = reply.statuses[i].args;
+            break;
+        }
+    }
+    if (line == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "agent sent no KEYINFO status");
+        goto end;
+    }
+
+    info = PyDict_New();
+    if (info == NULL)
+        goto end;
+    p = line;
+    for (field = 0; field < N_KEYINFO_FIELDS; field++) {
+        const char *start = NULL;
+        size_t length = 0;
+        PyObject *value;
+
+        while (*p == ' ')
+            p++;
+        if (*p != '\0') {
+            start = p;
+            length = strcspn(p, " ");
+            p += length;
+        }
+        if (strcmp(keyinfo_fields[field], "cached") == 0)
+            value = PyBool_FromLong(start != NULL && length == 1 &&
+                                    start[0] == '1');
+        else
+            value = decode_field(start, length);
+        if (value == NULL ||
+            PyDict_SetItemString(info, keyinfo_fields[field], value) < 0) {
+            Py_XDECREF(value);
+            Py_CLEAR(info);
+            goto end;
+        }
+        Py_DECREF(value);
+    }
+
+ end:
+    agent_reply_clear(&reply);
+    return info;
+}
+
+static const char pygpgme_agent_connection_getinfo_doc[] =
+    "getinfo($self, what)\n"
+    "--\n\n"
+    "Query the agent with the GETINFO command.\n"
+    "\n"
+    "Args:\n"
+    "  what (str): the item to ask for, such as ``\"version\"`` or\n"
+    "    ``\"pid\"``.\n"
+    "\n"
+    "Returns:\n"
+    "  str: the agent's reply.\n"
+    "\n"
+    "Raises:\n"
+    "  GpgmeError: if the agent does not know the item.\n";
+
+static PyObject *
+pygpgme_agent_connection_getinfo(PyGpgmeAgentConnection *self, PyObject *args)
+{
+    struct agent_reply reply = { 0 };
+    const char *what;
+    PyObject *command, *ret;
+
+    if (!PyArg_ParseTuple(args, "s", &what))
+        return NULL;
+
+    command = PyUnicode_FromFormat("GETINFO %s", what);
+    if (command == NULL)
+        return NULL;
+    if (agent_command(self, PyUnicode_AsUTF8(command), &reply) < 0) {
+        Py_DECREF(command);
+        return NULL;
+    }
+    Py_DECREF(command);
+
+    ret = PyUnicode_DecodeUTF8(reply.data ? reply.data : "", reply.data_len,
+                               "replace");
+    agent_reply_clear(&reply);
+    return ret;
+}
+
+static PyMethodDef pygpgme_agent_connection_methods[] = {
+    { "transact", (PyCFunction)pygpgme_agent_connection_transact,
+      METH_VARARGS, pygpgme_agent_connection_transact_doc },
+    { "preset_passphrase",
+      (PyCFunction)pygpgme_agent_connection_preset_passphrase,
+      METH_VARARGS | METH_KEYWORDS,
+      pygpgme_agent_connection_preset_passphrase_doc },
+    { "clear_passphrase",
+      (PyCFunction)pygpgme_agent_connection_clear_passphrase,
+      METH_VARARGS, pygpgme_agent_connection_clear_passphrase_doc },
+    { "keyinfo", (PyCFunction)pygpgme_agent_connection_keyinfo,
+      METH_VARARGS, pygpgme_agent_connection_keyinfo_doc },
+    { "getinfo", (PyCFunction)pygpgme_agent_connection_getinfo,
+      METH_VARARGS, pygpgme_agent_connection_getinfo_doc },
+    { NULL, 0, 0 }
+};
+
+static const char pygpgme_agent_connection_doc[] =
+    "AgentConnection(socket=None)\n"
+    "--\n\n"
+    "A control connection to gpg-agent.\n"
+    "\n"
+    "This can be used to load passphrases into the agent's cache once,\n"
+    "for example when a worker process starts, so that later operations\n"
+    "do not need a passphrase callback or pinentry.\n"
+    "\n"
+    "The connection is made when the first command is sent.  Commands\n"
+    "from several threads are sent one at a time.\n"
+    "\n"
+    "Args:\n"
+    "  socket (str | None): path of the agent's socket.  By default the\n"
+    "    socket of the default home directory is used.\n";
+
+static PyType_Slot pygpgme_agent_connection_slots[] = {
+    { Py_tp_dealloc, pygpgme_agent_connection_dealloc },
+    { Py_tp_new, pygpgme_agent_connection_new },
+    { Py_tp_methods, pygpgme_agent_connection_methods },
+    { Py_tp_doc, (void *)pygpgme_agent_connection_doc },
+    { 0, NULL },
+};
+
+PyType_Spec pygpgme_agent_connection_spec = {
+    .name = "gpgme.AgentConnection",
+    .basicsize = sizeof(PyGpgmeAgentConnection),
+    .flags = Py_TPFLAGS_DEFAULT
+#if PY_VERSION_HEX >= 0x030a0000
+    | Py_TPFLAGS_IMMUTABLETYPE
+#endif
+    ,
+    .slots = pygpgme_agent_connection_slots,
+};
@@ -19,1016 +19,1322 @@
  */
 #include "pygpgme.h"
 
-static void
-add_enum_value(PyObject *dict, const char *key, long value)
-{
-    PyObject *py_value = PyLong_FromLong(value);
+/* Values below this are cached in a dense array rather than a dict */
+#define DENSE_LIMIT 256
 
-    PyDict_SetItemString(dict, key, py_value);
-    Py_DECREF(py_value);
-}
+/* Number of values not declared in the enum (such as combinations of
+ * flags) that may be added to the cache on demand */
+#define EXTRA_CACHE_SIZE 256
+
+#ifdef Py_GIL_DISABLED
+#  define ENUM_LOCK(e) PyMutex_Lock(&(e)->mutex)
+#  define ENUM_UNLOCK(e) PyMutex_Unlock(&(e)->mutex)
+#else
+#  define ENUM_LOCK(e)
+#  define ENUM_UNLOCK(e)
+#endif
 
-static PyObject *
-make_enum(PyObject *mod, const char *base_name, const char *name, PyObject *values)
+/* Creates the enum class described by e->def, along with the cache of
+ * its members by value. */
+static int
+make_enum(PyGpgmeEnum *e)
 {
-    PyObject *enum_module, *base_class, *enum_name, *module_name, *kwnames;
+    const PyGpgmeEnumDef *def = e->def;
+    const PyGpgmeEnumValue *v;
+    PyObject *enum_module = NULL, *base_class = NULL, *kwnames = NULL;
     PyObject *args[4] = { NULL, };
-    PyObject *enum_class;
+    PyObject *values = NULL, *type = NULL, *members = NULL;
+    PyObject **dense = NULL;
+    long i, max_value = -1, n_dense = 0;
+    int is_dense = 1, ret = -1;
 
-    base_class = PyUnicode_FromString(base_name);
-    enum_name = PyUnicode_FromString(name);
-    module_name = PyUnicode_FromString("gpgme");
-    kwnames = Py_BuildValue("(s)", "module");
+    if (def == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "gpgme module has been cleared");
+        return -1;
+    }
+
+    values = PyDict_New();
+    if (values == NULL)
+        goto end;
+    for (v = def->values; v->name != NULL; v++) {
+        PyObject *py_value = PyLong_FromLong(v->value);
+
+        if (py_value == NULL)
+            goto end;
+        if (PyDict_SetItemString(values, v->name, py_value) < 0) {
+            Py_DECREF(py_value);
+            goto end;
+        }
+        Py_DECREF(py_value);
+        if (v->value < 0 || v->value >= DENSE_LIMIT)
+            is_dense = 0;
+        else if (v->value > max_value)
+            max_value = v->value;
+    }
 
     enum_module = PyImport_ImportModule("enum");
+    base_class = PyUnicode_FromString(def->base);
+    args[1] = PyUnicode_FromString(def->name);
+    args[3] = PyUnicode_FromString("gpgme");
+    kwnames = Py_BuildValue("(s)", "module");
+    if (enum_module == NULL || base_class == NULL || args[1] == NULL ||
+        args[3] == NULL || kwnames == NULL)
+        goto end;
     args[0] = enum_module;
-    args[1] = enum_name;
     args[2] = values;
-    args[3] = module_name;
+    type = PyObject_VectorcallMethod(base_class, args, 3 + PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
+    if (type == NULL)
+        goto end;
+
+    /* Cache the members by value.  Aliases resolve to the canonical
+     * member through getattr. */
+    members = PyDict_New();
+    if (members == NULL)
+        goto end;
+    if (is_dense && max_value >= 0) {
+        dense = PyMem_Calloc(max_value + 1, sizeof(PyObject *));
+        if (dense == NULL) {
+            PyErr_NoMemory();
+            goto end;
+        }
+        n_dense = max_value + 1;
+    }
+    for (v = def->values; v->name != NULL; v++) {
+        PyObject *member, *key;
+
+        member = PyObject_GetAttrString(type, v->name);
+        if (member == NULL) {
+            PyErr_Clear();
+            continue;
+        }
+        key = PyLong_FromLong(v->value);
+        if (key == NULL || PyDict_SetItem(members, key, member) < 0) {
+            Py_XDECREF(key);
+            Py_DECREF(member);
+            goto end;
+        }
+        Py_DECREF(key);
+        if (v->value >= 0 && v->value < n_dense && dense[v->value] == NULL) {
+            Py_INCREF(member);
+            dense[v->value] = member;
+        }
+        Py_DECREF(member);
+    }
+
+    /* another thread may have got here first */
+    ENUM_LOCK(e);
+    if (e->type == NULL) {
+        e->members = members;
+        e->dense = dense;
+        e->n_dense = n_dense;
+        e->cache_limit = PyDict_GET_SIZE(members) + EXTRA_CACHE_SIZE;
+        e->type = type;
+        members = NULL;
+        dense = NULL;
+        n_dense = 0;
+        type = NULL;
+    }
+    ENUM_UNLOCK(e);
+    ret = 0;
+
+ end:
+    for (i = 0; i < n_dense; i++)
+        Py_XDECREF(dense[i]);
+    PyMem_Free(dense);
+    Py_XDECREF(members);
+    Py_XDECREF(type);
+    Py_XDECREF(kwnames);
+    Py_XDECREF(args[3]);
+    Py_XDECREF(args[1]);
+    Py_XDECREF(base_class);
+    Py_XDECREF(enum_module);
+    Py_XDECREF(values);
+    return ret;
+}
+
+/* Returns a borrowed reference to the enum class, creating it on
+ * first use. */
+PyObject *
+pygpgme_enum_type(PyGpgmeEnum *e)
+{
+    PyObject *type;
 
-    enum_class = PyObject_VectorcallMethod(base_class, args, 3 + PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
+    ENUM_LOCK(e);
+    type = e->type;
+    ENUM_UNLOCK(e);
+    if (type != NULL)
+        return type;
 
-    Py_DECREF(enum_module);
-    Py_DECREF(kwnames);
-    Py_DECREF(module_name);
-    Py_DECREF(enum_name);
-    Py_DECREF(base_class);
+    if (make_enum(e) < 0)
+        return NULL;
+    ENUM_LOCK(e);
+    type = e->type;
+    ENUM_UNLOCK(e);
+    return type;
+}
+
+int
+pygpgme_enum_traverse(PyGpgmeEnum *e, visitproc visit, void *arg)
+{
+    long i;
 
-    PyModule_AddObject(mod, name, enum_class);
-    return enum_class;
+    Py_VISIT(e->type);
+    Py_VISIT(e->members);
+    for (i = 0; i < e->n_dense; i++)
+        Py_VISIT(e->dense[i]);
+    return 0;
 }
 
 void
-pygpgme_add_constants (PyObject *mod)
+pygpgme_enum_clear(PyGpgmeEnum *e)
 {
-    PyGpgmeModState *state = PyModule_GetState(mod);
-    PyObject *values;
+    long i;
 
-    /* gpgme_data_encoding_t */
-    values = PyDict_New();
+    Py_CLEAR(e->type);
+    Py_CLEAR(e->members);
+    for (i = 0; i < e->n_dense; i++)
+        Py_CLEAR(e->dense[i]);
+    PyMem_Free(e->dense);
+    e->dense = NULL;
+    e->n_dense = 0;
+    e->def = NULL;
+}
+
+/* gpgme_data_encoding_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_DATA_ENCODING_##name)
-    CONST(NONE);
-    CONST(BINARY);
-    CONST(BASE64);
-    CONST(ARMOR);
-    state->DataEncoding_Type = make_enum(mod, "IntEnum", "DataEncoding", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_DATA_ENCODING_##name }
+static const PyGpgmeEnumValue data_encoding_values[] = {
+    CONST(NONE),
+    CONST(BINARY),
+    CONST(BASE64),
+    CONST(ARMOR),
+    { NULL, 0 }
+};
 
-    /* gpgme_pubkey_algo_t */
-    values = PyDict_New();
+/* gpgme_pubkey_algo_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_PK_##name)
-    CONST(RSA);
-    CONST(RSA_E);
-    CONST(RSA_S);
-    CONST(ELG_E);
-    CONST(DSA);
-    CONST(ELG);
-    CONST(ECDSA);
-    CONST(ECDH);
-    CONST(EDDSA);
-    state->PubkeyAlgo_Type = make_enum(mod, "IntEnum", "PubkeyAlgo", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_PK_##name }
+static const PyGpgmeEnumValue pubkey_algo_values[] = {
+    CONST(RSA),
+    CONST(RSA_E),
+    CONST(RSA_S),
+    CONST(ELG_E),
+    CONST(DSA),
+    CONST(ELG),
+    CONST(ECDSA),
+    CONST(ECDH),
+    CONST(EDDSA),
+    { NULL, 0 }
+};
 
-    /* gpgme_hash_algo_t */
-    values = PyDict_New();
+/* gpgme_hash_algo_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_MD_##name)
-    CONST(NONE);
-    CONST(MD5);
-    CONST(SHA1);
-    CONST(RMD160);
-    CONST(MD2);
-    CONST(TIGER);
-    CONST(HAVAL);
-    CONST(SHA256);
-    CONST(SHA384);
-    CONST(SHA512);
-    CONST(MD4);
-    CONST(CRC32);
-    CONST(CRC32_RFC1510);
-    CONST(CRC24_RFC2440);
-    state->HashAlgo_Type = make_enum(mod, "IntEnum", "HashAlgo", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_MD_##name }
+static const PyGpgmeEnumValue hash_algo_values[] = {
+    CONST(NONE),
+    CONST(MD5),
+    CONST(SHA1),
+    CONST(RMD160),
+    CONST(MD2),
+    CONST(TIGER),
+    CONST(HAVAL),
+    CONST(SHA256),
+    CONST(SHA384),
+    CONST(SHA512),
+    CONST(MD4),
+    CONST(CRC32),
+    CONST(CRC32_RFC1510),
+    CONST(CRC24_RFC2440),
+    { NULL, 0 }
+};
 
-    /* gpgme_sig_mode_t */
-    values = PyDict_New();
+/* gpgme_sig_mode_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_SIG_MODE_##name)
-    CONST(NORMAL);
-    CONST(DETACH);
-    CONST(CLEAR);
-    state->SigMode_Type = make_enum(mod, "IntEnum", "SigMode", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_SIG_MODE_##name }
+static const PyGpgmeEnumValue sig_mode_values[] = {
+    CONST(NORMAL),
+    CONST(DETACH),
+    CONST(CLEAR),
+    { NULL, 0 }
+};
 
-    /* gpgme_validity_t */
-    values = PyDict_New();
+/* gpgme_validity_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_VALIDITY_##name)
-    CONST(UNKNOWN);
-    CONST(UNDEFINED);
-    CONST(NEVER);
-    CONST(MARGINAL);
-    CONST(FULL);
-    CONST(ULTIMATE);
-    state->Validity_Type = make_enum(mod, "IntEnum", "Validity", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_VALIDITY_##name }
+static const PyGpgmeEnumValue validity_values[] = {
+    CONST(UNKNOWN),
+    CONST(UNDEFINED),
+    CONST(NEVER),
+    CONST(MARGINAL),
+    CONST(FULL),
+    CONST(ULTIMATE),
+    { NULL, 0 }
+};
 
-    /* gpgme_protocol_t */
-    values = PyDict_New();
+/* gpgme_protocol_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_PROTOCOL_##name)
-    CONST(OpenPGP);
-    CONST(CMS);
-    CONST(GPGCONF);
-    CONST(ASSUAN);
-    CONST(G13);
-    CONST(UISERVER);
-    CONST(SPAWN);
-    CONST(DEFAULT);
-    CONST(UNKNOWN);
-    state->Protocol_Type = make_enum(mod, "IntEnum", "Protocol", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_PROTOCOL_##name }
+static const PyGpgmeEnumValue protocol_values[] = {
+    CONST(OpenPGP),
+    CONST(CMS),
+    CONST(GPGCONF),
+    CONST(ASSUAN),
+    CONST(G13),
+    CONST(UISERVER),
+    CONST(SPAWN),
+    CONST(DEFAULT),
+    CONST(UNKNOWN),
+    { NULL, 0 }
+};
 
-    /* gpgme_keylist_mode_t */
-    values = PyDict_New();
+/* gpgme_keylist_mode_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_KEYLIST_MODE_##name)
-    CONST(LOCAL);
-    CONST(EXTERN);
-    CONST(SIGS);
-    CONST(SIG_NOTATIONS);
-    CONST(WITH_SECRET);
-    CONST(WITH_TOFU);
-    CONST(EPHEMERAL);
-    CONST(VALIDATE);
-    CONST(LOCATE);
+#define CONST(name) { #name, GPGME_KEYLIST_MODE_##name }
+static const PyGpgmeEnumValue keylist_mode_values[] = {
+    CONST(LOCAL),
+    CONST(EXTERN),
+    CONST(SIGS),
+    CONST(SIG_NOTATIONS),
+    CONST(WITH_SECRET),
+    CONST(WITH_TOFU),
+    CONST(EPHEMERAL),
+    CONST(VALIDATE),
+    CONST(LOCATE),
 #if GPGME_VERSION_NUMBER >= VER(1, 14, 0)
-    CONST(WITH_KEYGRIP);
+    CONST(WITH_KEYGRIP),
 #endif
 #if GPGME_VERSION_NUMBER >= VER(1, 18, 0)
-    CONST(FORCE_EXTERN);
-    CONST(LOCATE_EXTERNAL);
+    CONST(FORCE_EXTERN),
+    CONST(LOCATE_EXTERNAL),
 #endif
-    state->KeylistMode_Type = make_enum(mod, "IntFlag", "KeylistMode", values);
-    Py_DECREF(values);
+    { NULL, 0 }
+};
 
-    /* gpgme_pinentry_mode_t */
-    values = PyDict_New();
+/* gpgme_pinentry_mode_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_PINENTRY_MODE_##name)
-    CONST(DEFAULT);
-    CONST(ASK);
-    CONST(CANCEL);
-    CONST(ERROR);
-    CONST(LOOPBACK);
-    state->PinentryMode_Type = make_enum(mod, "IntEnum", "PinentryMode", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_PINENTRY_MODE_##name }
+static const PyGpgmeEnumValue pinentry_mode_values[] = {
+    CONST(DEFAULT),
+    CONST(ASK),
+    CONST(CANCEL),
+    CONST(ERROR),
+    CONST(LOOPBACK),
+    { NULL, 0 }
+};
 
-    /* gpgme_export_mode_t */
-    values = PyDict_New();
+/* gpgme_export_mode_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_EXPORT_MODE_##name)
-    CONST(EXTERN);
-    CONST(MINIMAL);
-    CONST(SECRET);
-    CONST(RAW);
-    CONST(PKCS12);
+#define CONST(name) { #name, GPGME_EXPORT_MODE_##name }
+static const PyGpgmeEnumValue export_mode_values[] = {
+    CONST(EXTERN),
+    CONST(MINIMAL),
+    CONST(SECRET),
+    CONST(RAW),
+    CONST(PKCS12),
 #if GPGME_VERSION_NUMBER >= VER(1, 14, 0)
-    CONST(SSH);
+    CONST(SSH),
 #endif
 #if GPGME_VERSION_NUMBER >= VER(1, 17, 0)
-    CONST(SECRET_SUBKEY);
+    CONST(SECRET_SUBKEY),
 #endif
-    state->ExportMode_Type = make_enum(mod, "IntFlag", "ExportMode", values);
-    Py_DECREF(values);
+    { NULL, 0 }
+};
 
-    /* gpgme_sig_notation_flags_t */
-    values = PyDict_New();
+/* gpgme_sig_notation_flags_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_SIG_NOTATION_##name)
-    CONST(HUMAN_READABLE);
-    CONST(CRITICAL);
-    state->SigNotationFlags_Type = make_enum(mod, "IntFlag", "SigNotationFlags", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_SIG_NOTATION_##name }
+static const PyGpgmeEnumValue sig_notation_flags_values[] = {
+    CONST(HUMAN_READABLE),
+    CONST(CRITICAL),
+    { NULL, 0 }
+};
 
-    /* gpgme_status_code_t */
-    values = PyDict_New();
+/* gpgme_status_code_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_STATUS_##name)
-    CONST(EOF);
-    CONST(ENTER);
-    CONST(LEAVE);
-    CONST(ABORT);
-    CONST(GOODSIG);
-    CONST(BADSIG);
-    CONST(ERRSIG);
-    CONST(BADARMOR);
-    CONST(RSA_OR_IDEA);
-    CONST(KEYEXPIRED);
-    CONST(KEYREVOKED);
-    CONST(TRUST_UNDEFINED);
-    CONST(TRUST_NEVER);
-    CONST(TRUST_MARGINAL);
-    CONST(TRUST_FULLY);
-    CONST(TRUST_ULTIMATE);
-    CONST(SHM_INFO);
-    CONST(SHM_GET);
-    CONST(SHM_GET_BOOL);
-    CONST(SHM_GET_HIDDEN);
-    CONST(NEED_PASSPHRASE);
-    CONST(VALIDSIG);
-    CONST(SIG_ID);
-    CONST(ENC_TO);
-    CONST(NODATA);
-    CONST(BAD_PASSPHRASE);
-    CONST(NO_PUBKEY);
-    CONST(NO_SECKEY);
-    CONST(NEED_PASSPHRASE_SYM);
-    CONST(DECRYPTION_FAILED);
-    CONST(DECRYPTION_OKAY);
-    CONST(MISSING_PASSPHRASE);
-    CONST(GOOD_PASSPHRASE);
-    CONST(GOODMDC);
-    CONST(BADMDC);
-    CONST(ERRMDC);
-    CONST(IMPORTED);
-    CONST(IMPORT_OK);
-    CONST(IMPORT_PROBLEM);
-    CONST(IMPORT_RES);
-    CONST(FILE_START);
-    CONST(FILE_DONE);
-    CONST(FILE_ERROR);
-    CONST(BEGIN_DECRYPTION);
-    CONST(END_DECRYPTION);
-    CONST(BEGIN_ENCRYPTION);
-    CONST(END_ENCRYPTION);
-    CONST(DELETE_PROBLEM);
-    CONST(GET_BOOL);
-    CONST(GET_LINE);
-    CONST(GET_HIDDEN);
-    CONST(GOT_IT);
-    CONST(PROGRESS);
-    CONST(SIG_CREATED);
-    CONST(SESSION_KEY);
-    CONST(NOTATION_NAME);
-    CONST(NOTATION_DATA);
-    CONST(POLICY_URL);
-    CONST(BEGIN_STREAM);
-    CONST(END_STREAM);
-    CONST(KEY_CREATED);
-    CONST(USERID_HINT);
-    CONST(UNEXPECTED);
-    CONST(INV_RECP);
-    CONST(NO_RECP);
-    CONST(ALREADY_SIGNED);
-    CONST(SIGEXPIRED);
-    CONST(EXPSIG);
-    CONST(EXPKEYSIG);
-    CONST(TRUNCATED);
-    CONST(ERROR);
-    CONST(NEWSIG);
-    CONST(REVKEYSIG);
-    CONST(SIG_SUBPACKET);
-    CONST(NEED_PASSPHRASE_PIN);
-    CONST(SC_OP_FAILURE);
-    CONST(SC_OP_SUCCESS);
-    CONST(CARDCTRL);
-    CONST(BACKUP_KEY_CREATED);
-    CONST(PKA_TRUST_BAD);
-    CONST(PKA_TRUST_GOOD);
-    CONST(PLAINTEXT);
-    CONST(INV_SGNR);
-    CONST(NO_SGNR);
-    CONST(SUCCESS);
-    CONST(DECRYPTION_INFO);
-    CONST(PLAINTEXT_LENGTH);
-    CONST(MOUNTPOINT);
-    CONST(PINENTRY_LAUNCHED);
-    CONST(ATTRIBUTE);
-    CONST(BEGIN_SIGNING);
-    CONST(KEY_NOT_CREATED);
-    CONST(INQUIRE_MAXLEN);
-    CONST(FAILURE);
-    CONST(KEY_CONSIDERED);
-    CONST(TOFU_USER);
-    CONST(TOFU_STATS);
-    CONST(TOFU_STATS_LONG);
-    CONST(NOTATION_FLAGS);
-    CONST(DECRYPTION_COMPLIANCE_MODE);
-    CONST(VERIFICATION_COMPLIANCE_MODE);
+#define CONST(name) { #name, GPGME_STATUS_##name }
+static const PyGpgmeEnumValue status_values[] = {
+    CONST(EOF),
+    CONST(ENTER),
+    CONST(LEAVE),
+    CONST(ABORT),
+    CONST(GOODSIG),
+    CONST(BADSIG),
+    CONST(ERRSIG),
+    CONST(BADARMOR),
+    CONST(RSA_OR_IDEA),
+    CONST(KEYEXPIRED),
+    CONST(KEYREVOKED),
+    CONST(TRUST_UNDEFINED),
+    CONST(TRUST_NEVER),
+    CONST(TRUST_MARGINAL),
+    CONST(TRUST_FULLY),
+    CONST(TRUST_ULTIMATE),
+    CONST(SHM_INFO),
+    CONST(SHM_GET),
+    CONST(SHM_GET_BOOL),
+    CONST(SHM_GET_HIDDEN),
+    CONST(NEED_PASSPHRASE),
+    CONST(VALIDSIG),
+    CONST(SIG_ID),
+    CONST(ENC_TO),
+    CONST(NODATA),
+    CONST(BAD_PASSPHRASE),
+    CONST(NO_PUBKEY),
+    CONST(NO_SECKEY),
+    CONST(NEED_PASSPHRASE_SYM),
+    CONST(DECRYPTION_FAILED),
+    CONST(DECRYPTION_OKAY),
+    CONST(MISSING_PASSPHRASE),
+    CONST(GOOD_PASSPHRASE),
+    CONST(GOODMDC),
+    CONST(BADMDC),
+    CONST(ERRMDC),
+    CONST(IMPORTED),
+    CONST(IMPORT_OK),
+    CONST(IMPORT_PROBLEM),
+    CONST(IMPORT_RES),
+    CONST(FILE_START),
+    CONST(FILE_DONE),
+    CONST(FILE_ERROR),
+    CONST(BEGIN_DECRYPTION),
+    CONST(END_DECRYPTION),
+    CONST(BEGIN_ENCRYPTION),
+    CONST(END_ENCRYPTION),
+    CONST(DELETE_PROBLEM),
+    CONST(GET_BOOL),
+    CONST(GET_LINE),
+    CONST(GET_HIDDEN),
+    CONST(GOT_IT),
+    CONST(PROGRESS),
+    CONST(SIG_CREATED),
+    CONST(SESSION_KEY),
+    CONST(NOTATION_NAME),
+    CONST(NOTATION_DATA),
+    CONST(POLICY_URL),
+    CONST(BEGIN_STREAM),
+    CONST(END_STREAM),
+    CONST(KEY_CREATED),
+    CONST(USERID_HINT),
+    CONST(UNEXPECTED),
+    CONST(INV_RECP),
+    CONST(NO_RECP),
+    CONST(ALREADY_SIGNED),
+    CONST(SIGEXPIRED),
+    CONST(EXPSIG),
+    CONST(EXPKEYSIG),
+    CONST(TRUNCATED),
+    CONST(ERROR),
+    CONST(NEWSIG),
+    CONST(REVKEYSIG),
+    CONST(SIG_SUBPACKET),
+    CONST(NEED_PASSPHRASE_PIN),
+    CONST(SC_OP_FAILURE),
+    CONST(SC_OP_SUCCESS),
+    CONST(CARDCTRL),
+    CONST(BACKUP_KEY_CREATED),
+    CONST(PKA_TRUST_BAD),
+    CONST(PKA_TRUST_GOOD),
+    CONST(PLAINTEXT),
+    CONST(INV_SGNR),
+    CONST(NO_SGNR),
+    CONST(SUCCESS),
+    CONST(DECRYPTION_INFO),
+    CONST(PLAINTEXT_LENGTH),
+    CONST(MOUNTPOINT),
+    CONST(PINENTRY_LAUNCHED),
+    CONST(ATTRIBUTE),
+    CONST(BEGIN_SIGNING),
+    CONST(KEY_NOT_CREATED),
+    CONST(INQUIRE_MAXLEN),
+    CONST(FAILURE),
+    CONST(KEY_CONSIDERED),
+    CONST(TOFU_USER),
+    CONST(TOFU_STATS),
+    CONST(TOFU_STATS_LONG),
+    CONST(NOTATION_FLAGS),
+    CONST(DECRYPTION_COMPLIANCE_MODE),
+    CONST(VERIFICATION_COMPLIANCE_MODE),
 #if GPGME_VERSION_NUMBER >= VER(1, 15, 0)
-    CONST(CANCELED_BY_USER);
+    CONST(CANCELED_BY_USER),
 #endif
-    state->Status_Type = make_enum(mod, "IntEnum", "Status", values);
-    Py_DECREF(values);
+    { NULL, 0 }
+};
 
-    /* gpgme_encrypt_flags_t */
-    values = PyDict_New();
+/* gpgme_encrypt_flags_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_ENCRYPT_##name)
-    CONST(ALWAYS_TRUST);
-    CONST(NO_ENCRYPT_TO);
-    CONST(PREPARE);
-    CONST(EXPECT_SIGN);
-    CONST(NO_COMPRESS);
-    CONST(SYMMETRIC);
-    CONST(THROW_KEYIDS);
-    CONST(WRAP);
-    CONST(WANT_ADDRESS);
-    state->EncryptFlags_Type = make_enum(mod, "IntFlag", "EncryptFlags", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_ENCRYPT_##name }
+static const PyGpgmeEnumValue encrypt_flags_values[] = {
+    CONST(ALWAYS_TRUST),
+    CONST(NO_ENCRYPT_TO),
+    CONST(PREPARE),
+    CONST(EXPECT_SIGN),
+    CONST(NO_COMPRESS),
+    CONST(SYMMETRIC),
+    CONST(THROW_KEYIDS),
+    CONST(WRAP),
+    CONST(WANT_ADDRESS),
+    { NULL, 0 }
+};
 
-    /* gpgme_sigsum_t */
-    values = PyDict_New();
+/* gpgme_sigsum_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_SIGSUM_##name)
-    CONST(VALID);
-    CONST(GREEN);
-    CONST(RED);
-    CONST(KEY_REVOKED);
-    CONST(KEY_EXPIRED);
-    CONST(SIG_EXPIRED);
-    CONST(KEY_MISSING);
-    CONST(CRL_MISSING);
-    CONST(CRL_TOO_OLD);
-    CONST(BAD_POLICY);
-    CONST(SYS_ERROR);
-    CONST(TOFU_CONFLICT);
-    state->Sigsum_Type = make_enum(mod, "IntFlag", "Sigsum", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_SIGSUM_##name }
+static const PyGpgmeEnumValue sigsum_values[] = {
+    CONST(VALID),
+    CONST(GREEN),
+    CONST(RED),
+    CONST(KEY_REVOKED),
+    CONST(KEY_EXPIRED),
+    CONST(SIG_EXPIRED),
+    CONST(KEY_MISSING),
+    CONST(CRL_MISSING),
+    CONST(CRL_TOO_OLD),
+    CONST(BAD_POLICY),
+    CONST(SYS_ERROR),
+    CONST(TOFU_CONFLICT),
+    { NULL, 0 }
+};
 
-    /* import status */
-    values = PyDict_New();
+/* import status */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_IMPORT_##name)
-    CONST(NEW);
-    CONST(UID);
-    CONST(SIG);
-    CONST(SUBKEY);
-    CONST(SECRET);
-    state->Import_Type = make_enum(mod, "IntFlag", "Import", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_IMPORT_##name }
+static const PyGpgmeEnumValue import_values[] = {
+    CONST(NEW),
+    CONST(UID),
+    CONST(SIG),
+    CONST(SUBKEY),
+    CONST(SECRET),
+    { NULL, 0 }
+};
 
-    /* delete flags */
-    values = PyDict_New();
+/* delete flags */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPGME_DELETE_##name)
-    CONST(ALLOW_SECRET);
-    CONST(FORCE);
-    state->Delete_Type = make_enum(mod, "IntFlag", "Delete", values);
-    Py_DECREF(values);
+#define CONST(name) { #name, GPGME_DELETE_##name }
+static const PyGpgmeEnumValue delete_values[] = {
+    CONST(ALLOW_SECRET),
+    CONST(FORCE),
+    { NULL, 0 }
+};
 
-    /* gpg_err_source_t */
-    values = PyDict_New();
+/* flags column of Context.keylist_table() */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPG_ERR_SOURCE_##name)
-    CONST(UNKNOWN);
-    CONST(GCRYPT);
-    CONST(GPG);
-    CONST(GPGSM);
-    CONST(GPGAGENT);
-    CONST(PINENTRY);
-    CONST(SCD);
-    CONST(GPGME);
-    CONST(KEYBOX);
-    CONST(KSBA);
-    CONST(DIRMNGR);
-    CONST(GSTI);
-    CONST(GPA);
-    CONST(KLEO);
-    CONST(G13);
-    CONST(ASSUAN);
+#define CONST(name) { #name, PYGPGME_KEY_FLAG_##name }
+static const PyGpgmeEnumValue key_flags_values[] = {
+    CONST(REVOKED),
+    CONST(EXPIRED),
+    CONST(DISABLED),
+    CONST(INVALID),
+    CONST(CAN_ENCRYPT),
+    CONST(CAN_SIGN),
+    CONST(CAN_CERTIFY),
+    CONST(CAN_AUTHENTICATE),
+    CONST(SECRET),
+    { NULL, 0 }
+};
+
+/* gpg_err_source_t */
+#undef CONST
+#define CONST(name) { #name, GPG_ERR_SOURCE_##name }
+static const PyGpgmeEnumValue err_source_values[] = {
+    CONST(UNKNOWN),
+    CONST(GCRYPT),
+    CONST(GPG),
+    CONST(GPGSM),
+    CONST(GPGAGENT),
+    CONST(PINENTRY),
+    CONST(SCD),
+    CONST(GPGME),
+    CONST(KEYBOX),
+    CONST(KSBA),
+    CONST(DIRMNGR),
+    CONST(GSTI),
+    CONST(GPA),
+    CONST(KLEO),
+    CONST(G13),
+    CONST(ASSUAN),
 #if GPG_ERROR_VERSION_NUMBER >= VER(1, 42, 0)
-    CONST(TPM2D);
+    CONST(TPM2D),
 #endif
-    CONST(TLS);
+    CONST(TLS),
 #if GPG_ERROR_VERSION_NUMBER >= VER(1, 47, 0)
-    CONST(TKD);
+    CONST(TKD),
 #endif
-    CONST(ANY);
-    CONST(USER_1);
-    CONST(USER_2);
-    CONST(USER_3);
-    CONST(USER_4);
-    state->ErrSource_Type = make_enum(mod, "IntEnum", "ErrSource", values);
-    Py_DECREF(values);
+    CONST(ANY),
+    CONST(USER_1),
+    CONST(USER_2),
+    CONST(USER_3),
+    CONST(USER_4),
+    { NULL, 0 }
+};
 
-    /* gpg_err_code_t */
-    values = PyDict_New();
+/* gpg_err_code_t */
 #undef CONST
-#define CONST(name) add_enum_value(values, #name, GPG_ERR_##name)
-    CONST(NO_ERROR);
-    CONST(GENERAL);
-    CONST(UNKNOWN_PACKET);
-    CONST(UNKNOWN_VERSION);
-    CONST(PUBKEY_ALGO);
-    CONST(DIGEST_ALGO);
-    CONST(BAD_PUBKEY);
-    CONST(BAD_SECKEY);
-    CONST(BAD_SIGNATURE);
-    CONST(NO_PUBKEY);
-    CONST(CHECKSUM);
-    CONST(BAD_PASSPHRASE);
-    CONST(CIPHER_ALGO);
-    CONST(KEYRING_OPEN);
-    CONST(INV_PACKET);
-    CONST(INV_ARMOR);
-    CONST(NO_USER_ID);
-    CONST(NO_SECKEY);
-    CONST(WRONG_SECKEY);
-    CONST(BAD_KEY);
-    CONST(COMPR_ALGO);
-    CONST(NO_PRIME);
-    CONST(NO_ENCODING_METHOD);
-    CONST(NO_ENCRYPTION_SCHEME);
-    CONST(NO_SIGNATURE_SCHEME);
-    CONST(INV_ATTR);
-    CONST(NO_VALUE);
-    CONST(NOT_FOUND);
-    CONST(VALUE_NOT_FOUND);
-    CONST(SYNTAX);
-    CONST(BAD_MPI);
-    CONST(INV_PASSPHRASE);
-    CONST(SIG_CLASS);
-    CONST(RESOURCE_LIMIT);
-    CONST(INV_KEYRING);
-    CONST(TRUSTDB);
-    CONST(BAD_CERT);
-    CONST(INV_USER_ID);
-    CONST(UNEXPECTED);
-    CONST(TIME_CONFLICT);
-    CONST(KEYSERVER);
-    CONST(WRONG_PUBKEY_ALGO);
-    CONST(TRIBUTE_TO_D_A);
-    CONST(WEAK_KEY);
-    CONST(INV_KEYLEN);
-    CONST(INV_ARG);
-    CONST(BAD_URI);
-    CONST(INV_URI);
-    CONST(NETWORK);
-    CONST(UNKNOWN_HOST);
-    CONST(SELFTEST_FAILED);
-    CONST(NOT_ENCRYPTED);
-    CONST(NOT_PROCESSED);
-    CONST(UNUSABLE_PUBKEY);
-    CONST(UNUSABLE_SECKEY);
-    CONST(INV_VALUE);
-    CONST(BAD_CERT_CHAIN);
-    CONST(MISSING_CERT);
-    CONST(NO_DATA);
-    CONST(BUG);
-    CONST(NOT_SUPPORTED);
-    CONST(INV_OP);
-    CONST(TIMEOUT);
-    CONST(INTERNAL);
-    CONST(EOF_GCRYPT);
-    CONST(INV_OBJ);
-    CONST(TOO_SHORT);
-    CONST(TOO_LARGE);
-    CONST(NO_OBJ);
-    CONST(NOT_IMPLEMENTED);
-    CONST(CONFLICT);
-    CONST(INV_CIPHER_MODE);
-    CONST(INV_FLAG);
-    CONST(INV_HANDLE);
-    CONST(TRUNCATED);
-    CONST(INCOMPLETE_LINE);
-    CONST(INV_RESPONSE);
-    CONST(NO_AGENT);
-    CONST(AGENT);
-    CONST(INV_DATA);
-    CONST(ASSUAN_SERVER_FAULT);
-    CONST(ASSUAN);
-    CONST(INV_SESSION_KEY);
-    CONST(INV_SEXP);
-    CONST(UNSUPPORTED_ALGORITHM);
-    CONST(NO_PIN_ENTRY);
-    CONST(PIN_ENTRY);
-    CONST(BAD_PIN);
-    CONST(INV_NAME);
-    CONST(BAD_DATA);
-    CONST(INV_PARAMETER);
-    CONST(WRONG_CARD);
-    CONST(NO_DIRMNGR);
-    CONST(DIRMNGR);
-    CONST(CERT_REVOKED);
-    CONST(NO_CRL_KNOWN);
-    CONST(CRL_TOO_OLD);
-    CONST(LINE_TOO_LONG);
-    CONST(NOT_TRUSTED);
-    CONST(CANCELED);
-    CONST(BAD_CA_CERT);
-    CONST(CERT_EXPIRED);
-    CONST(CERT_TOO_YOUNG);
-    CONST(UNSUPPORTED_CERT);
-    CONST(UNKNOWN_SEXP);
-    CONST(UNSUPPORTED_PROTECTION);
-    CONST(CORRUPTED_PROTECTION);
-    CONST(AMBIGUOUS_NAME);
-    CONST(CARD);
-    CONST(CARD_RESET);
-    CONST(CARD_REMOVED);
-    CONST(INV_CARD);
-    CONST(CARD_NOT_PRESENT);
-    CONST(NO_PKCS15_APP);
-    CONST(NOT_CONFIRMED);
-    CONST(CONFIGURATION);
-    CONST(NO_POLICY_MATCH);
-    CONST(INV_INDEX);
-    CONST(INV_ID);
-    CONST(NO_SCDAEMON);
-    CONST(SCDAEMON);
-    CONST(UNSUPPORTED_PROTOCOL);
-    CONST(BAD_PIN_METHOD);
-    CONST(CARD_NOT_INITIALIZED);
-    CONST(UNSUPPORTED_OPERATION);
-    CONST(WRONG_KEY_USAGE);
-    CONST(NOTHING_FOUND);
-    CONST(WRONG_BLOB_TYPE);
-    CONST(MISSING_VALUE);
-    CONST(HARDWARE);
-    CONST(PIN_BLOCKED);
-    CONST(USE_CONDITIONS);
-    CONST(PIN_NOT_SYNCED);
-    CONST(INV_CRL);
-    CONST(BAD_BER);
-    CONST(INV_BER);
-    CONST(ELEMENT_NOT_FOUND);
-    CONST(IDENTIFIER_NOT_FOUND);
-    CONST(INV_TAG);
-    CONST(INV_LENGTH);
-    CONST(INV_KEYINFO);
-    CONST(UNEXPECTED_TAG);
-    CONST(NOT_DER_ENCODED);
-    CONST(NO_CMS_OBJ);
-    CONST(INV_CMS_OBJ);
-    CONST(UNKNOWN_CMS_OBJ);
-    CONST(UNSUPPORTED_CMS_OBJ);
-    CONST(UNSUPPORTED_ENCODING);
-    CONST(UNSUPPORTED_CMS_VERSION);
-    CONST(UNKNOWN_ALGORITHM);
-    CONST(INV_ENGINE);
-    CONST(PUBKEY_NOT_TRUSTED);
-    CONST(DECRYPT_FAILED);
-    CONST(KEY_EXPIRED);
-    CONST(SIG_EXPIRED);
-    CONST(ENCODING_PROBLEM);
-    CONST(INV_STATE);
-    CONST(DUP_VALUE);
-    CONST(MISSING_ACTION);
-    CONST(MODULE_NOT_FOUND);
-    CONST(INV_OID_STRING);
-    CONST(INV_TIME);
-    CONST(INV_CRL_OBJ);
-    CONST(UNSUPPORTED_CRL_VERSION);
-    CONST(INV_CERT_OBJ);
-    CONST(UNKNOWN_NAME);
-    CONST(LOCALE_PROBLEM);
-    CONST(NOT_LOCKED);
-    CONST(PROTOCOL_VIOLATION);
-    CONST(INV_MAC);
-    CONST(INV_REQUEST);
-    CONST(UNKNOWN_EXTN);
-    CONST(UNKNOWN_CRIT_EXTN);
-    CONST(LOCKED);
-    CONST(UNKNOWN_OPTION);
-    CONST(UNKNOWN_COMMAND);
-    CONST(NOT_OPERATIONAL);
-    CONST(NO_PASSPHRASE);
-    CONST(NO_PIN);
-    CONST(NOT_ENABLED);
-    CONST(NO_ENGINE);
-    CONST(MISSING_KEY);
-    CONST(TOO_MANY);
-    CONST(LIMIT_REACHED);
-    CONST(NOT_INITIALIZED);
-    CONST(MISSING_ISSUER_CERT);
-    CONST(NO_KEYSERVER);
-    CONST(INV_CURVE);
-    CONST(UNKNOWN_CURVE);
-    CONST(DUP_KEY);
-    CONST(AMBIGUOUS);
-    CONST(NO_CRYPT_CTX);
-    CONST(WRONG_CRYPT_CTX);
-    CONST(BAD_CRYPT_CTX);
-    CONST(CRYPT_CTX_CONFLICT);
-    CONST(BROKEN_PUBKEY);
-    CONST(BROKEN_SECKEY);
-    CONST(MAC_ALGO);
-    CONST(FULLY_CANCELED);
-    CONST(UNFINISHED);
-    CONST(BUFFER_TOO_SHORT);
-    CONST(SEXP_INV_LEN_SPEC);
-    CONST(SEXP_STRING_TOO_LONG);
-    CONST(SEXP_UNMATCHED_PAREN);
-    CONST(SEXP_NOT_CANONICAL);
-    CONST(SEXP_BAD_CHARACTER);
-    CONST(SEXP_BAD_QUOTATION);
-    CONST(SEXP_ZERO_PREFIX);
-    CONST(SEXP_NESTED_DH);
-    CONST(SEXP_UNMATCHED_DH);
-    CONST(SEXP_UNEXPECTED_PUNC);
-    CONST(SEXP_BAD_HEX_CHAR);
-    CONST(SEXP_ODD_HEX_NUMBERS);
-    CONST(SEXP_BAD_OCT_CHAR);
-    CONST(SUBKEYS_EXP_OR_REV);
-    CONST(DB_CORRUPTED);
-    CONST(SERVER_FAILED);
-    CONST(NO_NAME);
-    CONST(NO_KEY);
-    CONST(LEGACY_KEY);
-    CONST(REQUEST_TOO_SHORT);
-    CONST(REQUEST_TOO_LONG);
-    CONST(OBJ_TERM_STATE);
-    CONST(NO_CERT_CHAIN);
-    CONST(CERT_TOO_LARGE);
-    CONST(INV_RECORD);
-    CONST(BAD_MAC);
-    CONST(UNEXPECTED_MSG);
-    CONST(COMPR_FAILED);
-    CONST(WOULD_WRAP);
-    CONST(FATAL_ALERT);
-    CONST(NO_CIPHER);
-    CONST(MISSING_CLIENT_CERT);
-    CONST(CLOSE_NOTIFY);
-    CONST(TICKET_EXPIRED);
-    CONST(BAD_TICKET);
-    CONST(UNKNOWN_IDENTITY);
-    CONST(BAD_HS_CERT);
-    CONST(BAD_HS_CERT_REQ);
-    CONST(BAD_HS_CERT_VER);
-    CONST(BAD_HS_CHANGE_CIPHER);
-    CONST(BAD_HS_CLIENT_HELLO);
-    CONST(BAD_HS_SERVER_HELLO);
-    CONST(BAD_HS_SERVER_HELLO_DONE);
-    CONST(BAD_HS_FINISHED);
-    CONST(BAD_HS_SERVER_KEX);
-    CONST(BAD_HS_CLIENT_KEX);
-    CONST(BOGUS_STRING);
-    CONST(FORBIDDEN);
-    CONST(KEY_DISABLED);
-    CONST(KEY_ON_CARD);
-    CONST(INV_LOCK_OBJ);
-    CONST(TRUE);
-    CONST(FALSE);
-    CONST(ASS_GENERAL);
-    CONST(ASS_ACCEPT_FAILED);
-    CONST(ASS_CONNECT_FAILED);
-    CONST(ASS_INV_RESPONSE);
-    CONST(ASS_INV_VALUE);
-    CONST(ASS_INCOMPLETE_LINE);
-    CONST(ASS_LINE_TOO_LONG);
-    CONST(ASS_NESTED_COMMANDS);
-    CONST(ASS_NO_DATA_CB);
-    CONST(ASS_NO_INQUIRE_CB);
-    CONST(ASS_NOT_A_SERVER);
-    CONST(ASS_NOT_A_CLIENT);
-    CONST(ASS_SERVER_START);
-    CONST(ASS_READ_ERROR);
-    CONST(ASS_WRITE_ERROR);
-    CONST(ASS_TOO_MUCH_DATA);
-    CONST(ASS_UNEXPECTED_CMD);
-    CONST(ASS_UNKNOWN_CMD);
-    CONST(ASS_SYNTAX);
-    CONST(ASS_CANCELED);
-    CONST(ASS_NO_INPUT);
-    CONST(ASS_NO_OUTPUT);
-    CONST(ASS_PARAMETER);
-    CONST(ASS_UNKNOWN_INQUIRE);
-    CONST(ENGINE_TOO_OLD);
-    CONST(WINDOW_TOO_SMALL);
-    CONST(WINDOW_TOO_LARGE);
-    CONST(MISSING_ENVVAR);
-    CONST(USER_ID_EXISTS);
-    CONST(NAME_EXISTS);
-    CONST(DUP_NAME);
-    CONST(TOO_YOUNG);
-    CONST(TOO_OLD);
-    CONST(UNKNOWN_FLAG);
-    CONST(INV_ORDER);
-    CONST(ALREADY_FETCHED);
-    CONST(TRY_LATER);
+#define CONST(name) { #name, GPG_ERR_##name }
+static const PyGpgmeEnumValue err_code_values[] = {
+    CONST(NO_ERROR),
+    CONST(GENERAL),
+    CONST(UNKNOWN_PACKET),
+    CONST(UNKNOWN_VERSION),
+    CONST(PUBKEY_ALGO),
+    CONST(DIGEST_ALGO),
+    CONST(BAD_PUBKEY),
+    CONST(BAD_SECKEY),
+    CONST(BAD_SIGNATURE),
+    CONST(NO_PUBKEY),
+    CONST(CHECKSUM),
+    CONST(BAD_PASSPHRASE),
+    CONST(CIPHER_ALGO),
+    CONST(KEYRING_OPEN),
+    CONST(INV_PACKET),
+    CONST(INV_ARMOR),
+    CONST(NO_USER_ID),
+    CONST(NO_SECKEY),
+    CONST(WRONG_SECKEY),
+    CONST(BAD_KEY),
+    CONST(COMPR_ALGO),
+    CONST(NO_PRIME),
+    CONST(NO_ENCODING_METHOD),
+    CONST(NO_ENCRYPTION_SCHEME),
+    CONST(NO_SIGNATURE_SCHEME),
+    CONST(INV_ATTR),
+    CONST(NO_VALUE),
+    CONST(NOT_FOUND),
+    CONST(VALUE_NOT_FOUND),
+    CONST(SYNTAX),
+    CONST(BAD_MPI),
+    CONST(INV_PASSPHRASE),
+    CONST(SIG_CLASS),
+    CONST(RESOURCE_LIMIT),
+    CONST(INV_KEYRING),
+    CONST(TRUSTDB),
+    CONST(BAD_CERT),
+    CONST(INV_USER_ID),
+    CONST(UNEXPECTED),
+    CONST(TIME_CONFLICT),
+    CONST(KEYSERVER),
+    CONST(WRONG_PUBKEY_ALGO),
+    CONST(TRIBUTE_TO_D_A),
+    CONST(WEAK_KEY),
+    CONST(INV_KEYLEN),
+    CONST(INV_ARG),
+    CONST(BAD_URI),
+    CONST(INV_URI),
+    CONST(NETWORK),
+    CONST(UNKNOWN_HOST),
+    CONST(SELFTEST_FAILED),
+    CONST(NOT_ENCRYPTED),
+    CONST(NOT_PROCESSED),
+    CONST(UNUSABLE_PUBKEY),
+    CONST(UNUSABLE_SECKEY),
+    CONST(INV_VALUE),
+    CONST(BAD_CERT_CHAIN),
+    CONST(MISSING_CERT),
+    CONST(NO_DATA),
+    CONST(BUG),
+    CONST(NOT_SUPPORTED),
+    CONST(INV_OP),
+    CONST(TIMEOUT),
+    CONST(INTERNAL),
+    CONST(EOF_GCRYPT),
+    CONST(INV_OBJ),
+    CONST(TOO_SHORT),
+    CONST(TOO_LARGE),
+    CONST(NO_OBJ),
+    CONST(NOT_IMPLEMENTED),
+    CONST(CONFLICT),
+    CONST(INV_CIPHER_MODE),
+    CONST(INV_FLAG),
+    CONST(INV_HANDLE),
+    CONST(TRUNCATED),
+    CONST(INCOMPLETE_LINE),
+    CONST(INV_RESPONSE),
+    CONST(NO_AGENT),
+    CONST(AGENT),
+    CONST(INV_DATA),
+    CONST(ASSUAN_SERVER_FAULT),
+    CONST(ASSUAN),
+    CONST(INV_SESSION_KEY),
+    CONST(INV_SEXP),
+    CONST(UNSUPPORTED_ALGORITHM),
+    CONST(NO_PIN_ENTRY),
+    CONST(PIN_ENTRY),
+    CONST(BAD_PIN),
+    CONST(INV_NAME),
+    CONST(BAD_DATA),
+    CONST(INV_PARAMETER),
+    CONST(WRONG_CARD),
+    CONST(NO_DIRMNGR),
+    CONST(DIRMNGR),
+    CONST(CERT_REVOKED),
+    CONST(NO_CRL_KNOWN),
+    CONST(CRL_TOO_OLD),
+    CONST(LINE_TOO_LONG),
+    CONST(NOT_TRUSTED),
+    CONST(CANCELED),
+    CONST(BAD_CA_CERT),
+    CONST(CERT_EXPIRED),
+    CONST(CERT_TOO_YOUNG),
+    CONST(UNSUPPORTED_CERT),
+    CONST(UNKNOWN_SEXP),
+    CONST(UNSUPPORTED_PROTECTION),
+    CONST(CORRUPTED_PROTECTION),
+    CONST(AMBIGUOUS_NAME),
+    CONST(CARD),
+    CONST(CARD_RESET),
+    CONST(CARD_REMOVED),
+    CONST(INV_CARD),
+    CONST(CARD_NOT_PRESENT),
+    CONST(NO_PKCS15_APP),
+    CONST(NOT_CONFIRMED),
+    CONST(CONFIGURATION),
+    CONST(NO_POLICY_MATCH),
+    CONST(INV_INDEX),
+    CONST(INV_ID),
+    CONST(NO_SCDAEMON),
+    CONST(SCDAEMON),
+    CONST(UNSUPPORTED_PROTOCOL),
+    CONST(BAD_PIN_METHOD),
+    CONST(CARD_NOT_INITIALIZED),
+    CONST(UNSUPPORTED_OPERATION),
+    CONST(WRONG_KEY_USAGE),
+    CONST(NOTHING_FOUND),
+    CONST(WRONG_BLOB_TYPE),
+    CONST(MISSING_VALUE),
+    CONST(HARDWARE),
+    CONST(PIN_BLOCKED),
+    CONST(USE_CONDITIONS),
+    CONST(PIN_NOT_SYNCED),
+    CONST(INV_CRL),
+    CONST(BAD_BER),
+    CONST(INV_BER),
+    CONST(ELEMENT_NOT_FOUND),
+    CONST(IDENTIFIER_NOT_FOUND),
+    CONST(INV_TAG),
+    CONST(INV_LENGTH),
+    CONST(INV_KEYINFO),
+    CONST(UNEXPECTED_TAG),
+    CONST(NOT_DER_ENCODED),
+    CONST(NO_CMS_OBJ),
+    CONST(INV_CMS_OBJ),
+    CONST(UNKNOWN_CMS_OBJ),
+    CONST(UNSUPPORTED_CMS_OBJ),
+    CONST(UNSUPPORTED_ENCODING),
+    CONST(UNSUPPORTED_CMS_VERSION),
+    CONST(UNKNOWN_ALGORITHM),
+    CONST(INV_ENGINE),
+    CONST(PUBKEY_NOT_TRUSTED),
+    CONST(DECRYPT_FAILED),
+    CONST(KEY_EXPIRED),
+    CONST(SIG_EXPIRED),
+    CONST(ENCODING_PROBLEM),
+    CONST(INV_STATE),
+    CONST(DUP_VALUE),
+    CONST(MISSING_ACTION),
+    CONST(MODULE_NOT_FOUND),
+    CONST(INV_OID_STRING),
+    CONST(INV_TIME),
+    CONST(INV_CRL_OBJ),
+    CONST(UNSUPPORTED_CRL_VERSION),
+    CONST(INV_CERT_OBJ),
+    CONST(UNKNOWN_NAME),
+    CONST(LOCALE_PROBLEM),
+    CONST(NOT_LOCKED),
+    CONST(PROTOCOL_VIOLATION),
+    CONST(INV_MAC),
+    CONST(INV_REQUEST),
+    CONST(UNKNOWN_EXTN),
+    CONST(UNKNOWN_CRIT_EXTN),
+    CONST(LOCKED),
+    CONST(UNKNOWN_OPTION),
+    CONST(UNKNOWN_COMMAND),
+    CONST(NOT_OPERATIONAL),
+    CONST(NO_PASSPHRASE),
+    CONST(NO_PIN),
+    CONST(NOT_ENABLED),
+    CONST(NO_ENGINE),
+    CONST(MISSING_KEY),
+    CONST(TOO_MANY),
+    CONST(LIMIT_REACHED),
+    CONST(NOT_INITIALIZED),
+    CONST(MISSING_ISSUER_CERT),
+    CONST(NO_KEYSERVER),
+    CONST(INV_CURVE),
+    CONST(UNKNOWN_CURVE),
+    CONST(DUP_KEY),
+    CONST(AMBIGUOUS),
+    CONST(NO_CRYPT_CTX),
+    CONST(WRONG_CRYPT_CTX),
+    CONST(BAD_CRYPT_CTX),
+    CONST(CRYPT_CTX_CONFLICT),
+    CONST(BROKEN_PUBKEY),
+    CONST(BROKEN_SECKEY),
+    CONST(MAC_ALGO),
+    CONST(FULLY_CANCELED),
+    CONST(UNFINISHED),
+    CONST(BUFFER_TOO_SHORT),
+    CONST(SEXP_INV_LEN_SPEC),
+    CONST(SEXP_STRING_TOO_LONG),
+    CONST(SEXP_UNMATCHED_PAREN),
+    CONST(SEXP_NOT_CANONICAL),
+    CONST(SEXP_BAD_CHARACTER),
+    CONST(SEXP_BAD_QUOTATION),
+    CONST(SEXP_ZERO_PREFIX),
+    CONST(SEXP_NESTED_DH),
+    CONST(SEXP_UNMATCHED_DH),
+    CONST(SEXP_UNEXPECTED_PUNC),
+    CONST(SEXP_BAD_HEX_CHAR),
+    CONST(SEXP_ODD_HEX_NUMBERS),
+    CONST(SEXP_BAD_OCT_CHAR),
+    CONST(SUBKEYS_EXP_OR_REV),
+    CONST(DB_CORRUPTED),
+    CONST(SERVER_FAILED),
+    CONST(NO_NAME),
+    CONST(NO_KEY),
+    CONST(LEGACY_KEY),
+    CONST(REQUEST_TOO_SHORT),
+    CONST(REQUEST_TOO_LONG),
+    CONST(OBJ_TERM_STATE),
+    CONST(NO_CERT_CHAIN),
+    CONST(CERT_TOO_LARGE),
+    CONST(INV_RECORD),
+    CONST(BAD_MAC),
+    CONST(UNEXPECTED_MSG),
+    CONST(COMPR_FAILED),
+    CONST(WOULD_WRAP),
+    CONST(FATAL_ALERT),
+    CONST(NO_CIPHER),
+    CONST(MISSING_CLIENT_CERT),
+    CONST(CLOSE_NOTIFY),
+    CONST(TICKET_EXPIRED),
+    CONST(BAD_TICKET),
+    CONST(UNKNOWN_IDENTITY),
+    CONST(BAD_HS_CERT),
+    CONST(BAD_HS_CERT_REQ),
+    CONST(BAD_HS_CERT_VER),
+    CONST(BAD_HS_CHANGE_CIPHER),
+    CONST(BAD_HS_CLIENT_HELLO),
+    CONST(BAD_HS_SERVER_HELLO),
+    CONST(BAD_HS_SERVER_HELLO_DONE),
+    CONST(BAD_HS_FINISHED),
+    CONST(BAD_HS_SERVER_KEX),
+    CONST(BAD_HS_CLIENT_KEX),
+    CONST(BOGUS_STRING),
+    CONST(FORBIDDEN),
+    CONST(KEY_DISABLED),
+    CONST(KEY_ON_CARD),
+    CONST(INV_LOCK_OBJ),
+    CONST(TRUE),
+    CONST(FALSE),
+    CONST(ASS_GENERAL),
+    CONST(ASS_ACCEPT_FAILED),
+    CONST(ASS_CONNECT_FAILED),
+    CONST(ASS_INV_RESPONSE),
+    CONST(ASS_INV_VALUE),
+    CONST(ASS_INCOMPLETE_LINE),
+    CONST(ASS_LINE_TOO_LONG),
+    CONST(ASS_NESTED_COMMANDS),
+    CONST(ASS_NO_DATA_CB),
+    CONST(ASS_NO_INQUIRE_CB),
+    CONST(ASS_NOT_A_SERVER),
+    CONST(ASS_NOT_A_CLIENT),
+    CONST(ASS_SERVER_START),
+    CONST(ASS_READ_ERROR),
+    CONST(ASS_WRITE_ERROR),
+    CONST(ASS_TOO_MUCH_DATA),
+    CONST(ASS_UNEXPECTED_CMD),
+    CONST(ASS_UNKNOWN_CMD),
+    CONST(ASS_SYNTAX),
+    CONST(ASS_CANCELED),
+    CONST(ASS_NO_INPUT),
+    CONST(ASS_NO_OUTPUT),
+    CONST(ASS_PARAMETER),
+    CONST(ASS_UNKNOWN_INQUIRE),
+    CONST(ENGINE_TOO_OLD),
+    CONST(WINDOW_TOO_SMALL),
+    CONST(WINDOW_TOO_LARGE),
+    CONST(MISSING_ENVVAR),
+    CONST(USER_ID_EXISTS),
+    CONST(NAME_EXISTS),
+    CONST(DUP_NAME),
+    CONST(TOO_YOUNG),
+    CONST(TOO_OLD),
+    CONST(UNKNOWN_FLAG),
+    CONST(INV_ORDER),
+    CONST(ALREADY_FETCHED),
+    CONST(TRY_LATER),
 #if GPG_ERROR_VERSION_NUMBER >= VER(1, 27, 0)
-    CONST(WRONG_NAME);
+    CONST(WRONG_NAME),
 #endif
 #if GPG_ERROR_VERSION_NUMBER >= VER(1, 36, 0)
-    CONST(NO_AUTH);
-    CONST(BAD_AUTH);
+    CONST(NO_AUTH),
+    CONST(BAD_AUTH),
 #endif
 #if GPG_ERROR_VERSION_NUMBER >= VER(1, 37, 0)
-    CONST(NO_KEYBOXD);
-    CONST(KEYBOXD);
-    CONST(NO_SERVICE);
-    CONST(SERVICE);
+    CONST(NO_KEYBOXD),
+    CONST(KEYBOXD),
+    CONST(NO_SERVICE),
+    CONST(SERVICE),
 #endif
 #if GPG_ERROR_VERSION_NUMBER >= VER(1, 47, 0)
-    CONST(BAD_PUK);
-    CONST(NO_RESET_CODE);
-    CONST(BAD_RESET_CODE);
+    CONST(BAD_PUK),
+    CONST(NO_RESET_CODE),
+    CONST(BAD_RESET_CODE),
 #endif
-    CONST(SYSTEM_BUG);
-    CONST(DNS_UNKNOWN);
-    CONST(DNS_SECTION);
-    CONST(DNS_ADDRESS);
-    CONST(DNS_NO_QUERY);
-    CONST(DNS_NO_ANSWER);
-    CONST(DNS_CLOSED);
-    CONST(DNS_VERIFY);
-    CONST(DNS_TIMEOUT);
-    CONST(LDAP_GENERAL);
-    CONST(LDAP_ATTR_GENERAL);
-    CONST(LDAP_NAME_GENERAL);
-    CONST(LDAP_SECURITY_GENERAL);
-    CONST(LDAP_SERVICE_GENERAL);
-    CONST(LDAP_UPDATE_GENERAL);
-    CONST(LDAP_E_GENERAL);
-    CONST(LDAP_X_GENERAL);
-    CONST(LDAP_OTHER_GENERAL);
-    CONST(LDAP_X_CONNECTING);
-    CONST(LDAP_REFERRAL_LIMIT);
-    CONST(LDAP_CLIENT_LOOP);
-    CONST(LDAP_NO_RESULTS);
-    CONST(LDAP_CONTROL_NOT_FOUND);
-    CONST(LDAP_NOT_SUPPORTED);
-    CONST(LDAP_CONNECT);
-    CONST(LDAP_NO_MEMORY);
-    CONST(LDAP_PARAM);
-    CONST(LDAP_USER_CANCELLED);
-    CONST(LDAP_FILTER);
-    CONST(LDAP_AUTH_UNKNOWN);
-    CONST(LDAP_TIMEOUT);
-    CONST(LDAP_DECODING);
-    CONST(LDAP_ENCODING);
-    CONST(LDAP_LOCAL);
-    CONST(LDAP_SERVER_DOWN);
-    CONST(LDAP_SUCCESS);
-    CONST(LDAP_OPERATIONS);
-    CONST(LDAP_PROTOCOL);
-    CONST(LDAP_TIMELIMIT);
-    CONST(LDAP_SIZELIMIT);
-    CONST(LDAP_COMPARE_FALSE);
-    CONST(LDAP_COMPARE_TRUE);
-    CONST(LDAP_UNSUPPORTED_AUTH);
-    CONST(LDAP_STRONG_AUTH_RQRD);
-    CONST(LDAP_PARTIAL_RESULTS);
-    CONST(LDAP_REFERRAL);
-    CONST(LDAP_ADMINLIMIT);
-    CONST(LDAP_UNAVAIL_CRIT_EXTN);
-    CONST(LDAP_CONFIDENT_RQRD);
-    CONST(LDAP_SASL_BIND_INPROG);
-    CONST(LDAP_NO_SUCH_ATTRIBUTE);
-    CONST(LDAP_UNDEFINED_TYPE);
-    CONST(LDAP_BAD_MATCHING);
-    CONST(LDAP_CONST_VIOLATION);
-    CONST(LDAP_TYPE_VALUE_EXISTS);
-    CONST(LDAP_INV_SYNTAX);
-    CONST(LDAP_NO_SUCH_OBJ);
-    CONST(LDAP_ALIAS_PROBLEM);
-    CONST(LDAP_INV_DN_SYNTAX);
-    CONST(LDAP_IS_LEAF);
-    CONST(LDAP_ALIAS_DEREF);
-    CONST(LDAP_X_PROXY_AUTH_FAIL);
-    CONST(LDAP_BAD_AUTH);
-    CONST(LDAP_INV_CREDENTIALS);
-    CONST(LDAP_INSUFFICIENT_ACC);
-    CONST(LDAP_BUSY);
-    CONST(LDAP_UNAVAILABLE);
-    CONST(LDAP_UNWILL_TO_PERFORM);
-    CONST(LDAP_LOOP_DETECT);
-    CONST(LDAP_NAMING_VIOLATION);
-    CONST(LDAP_OBJ_CLS_VIOLATION);
-    CONST(LDAP_NOT_ALLOW_NONLEAF);
-    CONST(LDAP_NOT_ALLOW_ON_RDN);
-    CONST(LDAP_ALREADY_EXISTS);
-    CONST(LDAP_NO_OBJ_CLASS_MODS);
-    CONST(LDAP_RESULTS_TOO_LARGE);
-    CONST(LDAP_AFFECTS_MULT_DSAS);
-    CONST(LDAP_VLV);
-    CONST(LDAP_OTHER);
-    CONST(LDAP_CUP_RESOURCE_LIMIT);
-    CONST(LDAP_CUP_SEC_VIOLATION);
-    CONST(LDAP_CUP_INV_DATA);
-    CONST(LDAP_CUP_UNSUP_SCHEME);
-    CONST(LDAP_CUP_RELOAD);
-    CONST(LDAP_CANCELLED);
-    CONST(LDAP_NO_SUCH_OPERATION);
-    CONST(LDAP_TOO_LATE);
-    CONST(LDAP_CANNOT_CANCEL);
-    CONST(LDAP_ASSERTION_FAILED);
-    CONST(LDAP_PROX_AUTH_DENIED);
-    CONST(USER_1);
-    CONST(USER_2);
-    CONST(USER_3);
-    CONST(USER_4);
-    CONST(USER_5);
-    CONST(USER_6);
-    CONST(USER_7);
-    CONST(USER_8);
-    CONST(USER_9);
-    CONST(USER_10);
-    CONST(USER_11);
-    CONST(USER_12);
-    CONST(USER_13);
-    CONST(USER_14);
-    CONST(USER_15);
-    CONST(USER_16);
+    CONST(SYSTEM_BUG),
+    CONST(DNS_UNKNOWN),
+    CONST(DNS_SECTION),
+    CONST(DNS_ADDRESS),
+    CONST(DNS_NO_QUERY),
+    CONST(DNS_NO_ANSWER),
+    CONST(DNS_CLOSED),
+    CONST(DNS_VERIFY),
+    CONST(DNS_TIMEOUT),
+    CONST(LDAP_GENERAL),
+    CONST(LDAP_ATTR_GENERAL),
+    CONST(LDAP_NAME_GENERAL),
+    CONST(LDAP_SECURITY_GENERAL),
+    CONST(LDAP_SERVICE_GENERAL),
+    CONST(LDAP_UPDATE_GENERAL),
+    CONST(LDAP_E_GENERAL),
+    CONST(LDAP_X_GENERAL),
+    CONST(LDAP_OTHER_GENERAL),
+    CONST(LDAP_X_CONNECTING),
+    CONST(LDAP_REFERRAL_LIMIT),
+    CONST(LDAP_CLIENT_LOOP),
+    CONST(LDAP_NO_RESULTS),
+    CONST(LDAP_CONTROL_NOT_FOUND),
+    CONST(LDAP_NOT_SUPPORTED),
+    CONST(LDAP_CONNECT),
+    CONST(LDAP_NO_MEMORY),
+    CONST(LDAP_PARAM),
+    CONST(LDAP_USER_CANCELLED),
+    CONST(LDAP_FILTER),
+    CONST(LDAP_AUTH_UNKNOWN),
+    CONST(LDAP_TIMEOUT),
+    CONST(LDAP_DECODING),
+    CONST(LDAP_ENCODING),
+    CONST(LDAP_LOCAL),
+    CONST(LDAP_SERVER_DOWN),
+    CONST(LDAP_SUCCESS),
+    CONST(LDAP_OPERATIONS),
+    CONST(LDAP_PROTOCOL),
+    CONST(LDAP_TIMELIMIT),
+    CONST(LDAP_SIZELIMIT),
+    CONST(LDAP_COMPARE_FALSE),
+    CONST(LDAP_COMPARE_TRUE),
+    CONST(LDAP_UNSUPPORTED_AUTH),
+    CONST(LDAP_STRONG_AUTH_RQRD),
+    CONST(LDAP_PARTIAL_RESULTS),
+    CONST(LDAP_REFERRAL),
+    CONST(LDAP_ADMINLIMIT),
+    CONST(LDAP_UNAVAIL_CRIT_EXTN),
+    CONST(LDAP_CONFIDENT_RQRD),
+    CONST(LDAP_SASL_BIND_INPROG),
+    CONST(LDAP_NO_SUCH_ATTRIBUTE),
+    CONST(LDAP_UNDEFINED_TYPE),
+    CONST(LDAP_BAD_MATCHING),
+    CONST(LDAP_CONST_VIOLATION),
+    CONST(LDAP_TYPE_VALUE_EXISTS),
+    CONST(LDAP_INV_SYNTAX),
+    CONST(LDAP_NO_SUCH_OBJ),
+    CONST(LDAP_ALIAS_PROBLEM),
+    CONST(LDAP_INV_DN_SYNTAX),
+    CONST(LDAP_IS_LEAF),
+    CONST(LDAP_ALIAS_DEREF),
+    CONST(LDAP_X_PROXY_AUTH_FAIL),
+    CONST(LDAP_BAD_AUTH),
+    CONST(LDAP_INV_CREDENTIALS),
+    CONST(LDAP_INSUFFICIENT_ACC),
+    CONST(LDAP_BUSY),
+    CONST(LDAP_UNAVAILABLE),
+    CONST(LDAP_UNWILL_TO_PERFORM),
+    CONST(LDAP_LOOP_DETECT),
+    CONST(LDAP_NAMING_VIOLATION),
+    CONST(LDAP_OBJ_CLS_VIOLATION),
+    CONST(LDAP_NOT_ALLOW_NONLEAF),
+    CONST(LDAP_NOT_ALLOW_ON_RDN),
+    CONST(LDAP_ALREADY_EXISTS),
+    CONST(LDAP_NO_OBJ_CLASS_MODS),
+    CONST(LDAP_RESULTS_TOO_LARGE),
+    CONST(LDAP_AFFECTS_MULT_DSAS),
+    CONST(LDAP_VLV),
+    CONST(LDAP_OTHER),
+    CONST(LDAP_CUP_RESOURCE_LIMIT),
+    CONST(LDAP_CUP_SEC_VIOLATION),
+    CONST(LDAP_CUP_INV_DATA),
+    CONST(LDAP_CUP_UNSUP_SCHEME),
+    CONST(LDAP_CUP_RELOAD),
+    CONST(LDAP_CANCELLED),
+    CONST(LDAP_NO_SUCH_OPERATION),
+    CONST(LDAP_TOO_LATE),
+    CONST(LDAP_CANNOT_CANCEL),
+    CONST(LDAP_ASSERTION_FAILED),
+    CONST(LDAP_PROX_AUTH_DENIED),
+    CONST(USER_1),
+    CONST(USER_2),
+    CONST(USER_3),
+    CONST(USER_4),
+    CONST(USER_5),
+    CONST(USER_6),
+    CONST(USER_7),
+    CONST(USER_8),
+    CONST(USER_9),
+    CONST(USER_10),
+    CONST(USER_11),
+    CONST(USER_12),
+    CONST(USER_13),
+    CONST(USER_14),
+    CONST(USER_15),
+    CONST(USER_16),
 #if GPG_ERROR_VERSION_NUMBER >= VER(1, 37, 0)
-    CONST(SQL_OK);
-    CONST(SQL_ERROR);
-    CONST(SQL_INTERNAL);
-    CONST(SQL_PERM);
-    CONST(SQL_ABORT);
-    CONST(SQL_BUSY);
-    CONST(SQL_LOCKED);
-    CONST(SQL_NOMEM);
-    CONST(SQL_READONLY);
-    CONST(SQL_INTERRUPT);
-    CONST(SQL_IOERR);
-    CONST(SQL_CORRUPT);
-    CONST(SQL_NOTFOUND);
-    CONST(SQL_FULL);
-    CONST(SQL_CANTOPEN);
-    CONST(SQL_PROTOCOL);
-    CONST(SQL_EMPTY);
-    CONST(SQL_SCHEMA);
-    CONST(SQL_TOOBIG);
-    CONST(SQL_CONSTRAINT);
-    CONST(SQL_MISMATCH);
-    CONST(SQL_MISUSE);
-    CONST(SQL_NOLFS);
-    CONST(SQL_AUTH);
-    CONST(SQL_FORMAT);
-    CONST(SQL_RANGE);
-    CONST(SQL_NOTADB);
-    CONST(SQL_NOTICE);
-    CONST(SQL_WARNING);
-    CONST(SQL_ROW);
-    CONST(SQL_DONE);
+    CONST(SQL_OK),
+    CONST(SQL_ERROR),
+    CONST(SQL_INTERNAL),
+    CONST(SQL_PERM),
+    CONST(SQL_ABORT),
+    CONST(SQL_BUSY),
+    CONST(SQL_LOCKED),
+    CONST(SQL_NOMEM),
+    CONST(SQL_READONLY),
+    CONST(SQL_INTERRUPT),
+    CONST(SQL_IOERR),
+    CONST(SQL_CORRUPT),
+    CONST(SQL_NOTFOUND),
+    CONST(SQL_FULL),
+    CONST(SQL_CANTOPEN),
+    CONST(SQL_PROTOCOL),
+    CONST(SQL_EMPTY),
+    CONST(SQL_SCHEMA),
+    CONST(SQL_TOOBIG),
+    CONST(SQL_CONSTRAINT),
+    CONST(SQL_MISMATCH),
+    CONST(SQL_MISUSE),
+    CONST(SQL_NOLFS),
+    CONST(SQL_AUTH),
+    CONST(SQL_FORMAT),
+    CONST(SQL_RANGE),
+    CONST(SQL_NOTADB),
+    CONST(SQL_NOTICE),
+    CONST(SQL_WARNING),
+    CONST(SQL_ROW),
+    CONST(SQL_DONE),
 #endif
-    CONST(MISSING_ERRNO);
-    CONST(UNKNOWN_ERRNO);
-    CONST(EOF);
-    CONST(E2BIG);
-    CONST(EACCES);
-    CONST(EADDRINUSE);
-    CONST(EADDRNOTAVAIL);
-    CONST(EADV);
-    CONST(EAFNOSUPPORT);
-    CONST(EAGAIN);
-    CONST(EALREADY);
-    CONST(EAUTH);
-    CONST(EBACKGROUND);
-    CONST(EBADE);
-    CONST(EBADF);
-    CONST(EBADFD);
-    CONST(EBADMSG);
-    CONST(EBADR);
-    CONST(EBADRPC);
-    CONST(EBADRQC);
-    CONST(EBADSLT);
-    CONST(EBFONT);
-    CONST(EBUSY);
-    CONST(ECANCELED);
-    CONST(ECHILD);
-    CONST(ECHRNG);
-    CONST(ECOMM);
-    CONST(ECONNABORTED);
-    CONST(ECONNREFUSED);
-    CONST(ECONNRESET);
-    CONST(ED);
-    CONST(EDEADLK);
-    CONST(EDEADLOCK);
-    CONST(EDESTADDRREQ);
-    CONST(EDIED);
-    CONST(EDOM);
-    CONST(EDOTDOT);
-    CONST(EDQUOT);
-    CONST(EEXIST);
-    CONST(EFAULT);
-    CONST(EFBIG);
-    CONST(EFTYPE);
-    CONST(EGRATUITOUS);
-    CONST(EGREGIOUS);
-    CONST(EHOSTDOWN);
-    CONST(EHOSTUNREACH);
-    CONST(EIDRM);
-    CONST(EIEIO);
-    CONST(EILSEQ);
-    CONST(EINPROGRESS);
-    CONST(EINTR);
-    CONST(EINVAL);
-    CONST(EIO);
-    CONST(EISCONN);
-    CONST(EISDIR);
-    CONST(EISNAM);
-    CONST(EL2HLT);
-    CONST(EL2NSYNC);
-    CONST(EL3HLT);
-    CONST(EL3RST);
-    CONST(ELIBACC);
-    CONST(ELIBBAD);
-    CONST(ELIBEXEC);
-    CONST(ELIBMAX);
-    CONST(ELIBSCN);
-    CONST(ELNRNG);
-    CONST(ELOOP);
-    CONST(EMEDIUMTYPE);
-    CONST(EMFILE);
-    CONST(EMLINK);
-    CONST(EMSGSIZE);
-    CONST(EMULTIHOP);
-    CONST(ENAMETOOLONG);
-    CONST(ENAVAIL);
-    CONST(ENEEDAUTH);
-    CONST(ENETDOWN);
-    CONST(ENETRESET);
-    CONST(ENETUNREACH);
-    CONST(ENFILE);
-    CONST(ENOANO);
-    CONST(ENOBUFS);
-    CONST(ENOCSI);
-    CONST(ENODATA);
-    CONST(ENODEV);
-    CONST(ENOENT);
-    CONST(ENOEXEC);
-    CONST(ENOLCK);
-    CONST(ENOLINK);
-    CONST(ENOMEDIUM);
-    CONST(ENOMEM);
-    CONST(ENOMSG);
-    CONST(ENONET);
-    CONST(ENOPKG);
-    CONST(ENOPROTOOPT);
-    CONST(ENOSPC);
-    CONST(ENOSR);
-    CONST(ENOSTR);
-    CONST(ENOSYS);
-    CONST(ENOTBLK);
-    CONST(ENOTCONN);
-    CONST(ENOTDIR);
-    CONST(ENOTEMPTY);
-    CONST(ENOTNAM);
-    CONST(ENOTSOCK);
-    CONST(ENOTSUP);
-    CONST(ENOTTY);
-    CONST(ENOTUNIQ);
-    CONST(ENXIO);
-    CONST(EOPNOTSUPP);
-    CONST(EOVERFLOW);
-    CONST(EPERM);
-    CONST(EPFNOSUPPORT);
-    CONST(EPIPE);
-    CONST(EPROCLIM);
-    CONST(EPROCUNAVAIL);
-    CONST(EPROGMISMATCH);
-    CONST(EPROGUNAVAIL);
-    CONST(EPROTO);
-    CONST(EPROTONOSUPPORT);
-    CONST(EPROTOTYPE);
-    CONST(ERANGE);
-    CONST(EREMCHG);
-    CONST(EREMOTE);
-    CONST(EREMOTEIO);
-    CONST(ERESTART);
-    CONST(EROFS);
-    CONST(ERPCMISMATCH);
-    CONST(ESHUTDOWN);
-    CONST(ESOCKTNOSUPPORT);
-    CONST(ESPIPE);
-    CONST(ESRCH);
-    CONST(ESRMNT);
-    CONST(ESTALE);
-    CONST(ESTRPIPE);
-    CONST(ETIME);
-    CONST(ETIMEDOUT);
-    CONST(ETOOMANYREFS);
-    CONST(ETXTBSY);
-    CONST(EUCLEAN);
-    CONST(EUNATCH);
-    CONST(EUSERS);
-    CONST(EWOULDBLOCK);
-    CONST(EXDEV);
-    CONST(EXFULL);
-    state->ErrCode_Type = make_enum(mod, "IntEnum", "ErrCode", values);
-    Py_DECREF(values);
+    CONST(MISSING_ERRNO),
+    CONST(UNKNOWN_ERRNO),
+    CONST(EOF),
+    CONST(E2BIG),
+    CONST(EACCES),
+    CONST(EADDRINUSE),
+    CONST(EADDRNOTAVAIL),
+    CONST(EADV),
+    CONST(EAFNOSUPPORT),
+    CONST(EAGAIN),
+    CONST(EALREADY),
+    CONST(EAUTH),
+    CONST(EBACKGROUND),
+    CONST(EBADE),
+    CONST(EBADF),
+    CONST(EBADFD),
+    CONST(EBADMSG),
+    CONST(EBADR),
+    CONST(EBADRPC),
+    CONST(EBADRQC),
+    CONST(EBADSLT),
+    CONST(EBFONT),
+    CONST(EBUSY),
+    CONST(ECANCELED),
+    CONST(ECHILD),
+    CONST(ECHRNG),
+    CONST(ECOMM),
+    CONST(ECONNABORTED),
+    CONST(ECONNREFUSED),
+    CONST(ECONNRESET),
+    CONST(ED),
+    CONST(EDEADLK),
+    CONST(EDEADLOCK),
+    CONST(EDESTADDRREQ),
+    CONST(EDIED),
+    CONST(EDOM),
+    CONST(EDOTDOT),
+    CONST(EDQUOT),
+    CONST(EEXIST),
+    CONST(EFAULT),
+    CONST(EFBIG),
+    CONST(EFTYPE),
+    CONST(EGRATUITOUS),
+    CONST(EGREGIOUS),
+    CONST(EHOSTDOWN),
+    CONST(EHOSTUNREACH),
+    CONST(EIDRM),
+    CONST(EIEIO),
+    CONST(EILSEQ),
+    CONST(EINPROGRESS),
+    CONST(EINTR),
+    CONST(EINVAL),
+    CONST(EIO),
+    CONST(EISCONN),
+    CONST(EISDIR),
+    CONST(EISNAM),
+    CONST(EL2HLT),
+    CONST(EL2NSYNC),
+    CONST(EL3HLT),
+    CONST(EL3RST),
+    CONST(ELIBACC),
+    CONST(ELIBBAD),
+    CONST(ELIBEXEC),
+    CONST(ELIBMAX),
+    CONST(ELIBSCN),
+    CONST(ELNRNG),
+    CONST(ELOOP),
+    CONST(EMEDIUMTYPE),
+    CONST(EMFILE),
+    CONST(EMLINK),
+    CONST(EMSGSIZE),
+    CONST(EMULTIHOP),
+    CONST(ENAMETOOLONG),
+    CONST(ENAVAIL),
+    CONST(ENEEDAUTH),
+    CONST(ENETDOWN),
+    CONST(ENETRESET),
+    CONST(ENETUNREACH),
+    CONST(ENFILE),
+    CONST(ENOANO),
+    CONST(ENOBUFS),
+    CONST(ENOCSI),
+    CONST(ENODATA),
+    CONST(ENODEV),
+    CONST(ENOENT),
+    CONST(ENOEXEC),
+    CONST(ENOLCK),
+    CONST(ENOLINK),
+    CONST(ENOMEDIUM),
+    CONST(ENOMEM),
+    CONST(ENOMSG),
+    CONST(ENONET),
+    CONST(ENOPKG),
+    CONST(ENOPROTOOPT),
+    CONST(ENOSPC),
+    CONST(ENOSR),
+    CONST(ENOSTR),
+    CONST(ENOSYS),
+    CONST(ENOTBLK),
+    CONST(ENOTCONN),
+    CONST(ENOTDIR),
+    CONST(ENOTEMPTY),
+    CONST(ENOTNAM),
+    CONST(ENOTSOCK),
+    CONST(ENOTSUP),
+    CONST(ENOTTY),
+    CONST(ENOTUNIQ),
+    CONST(ENXIO),
+    CONST(EOPNOTSUPP),
+    CONST(EOVERFLOW),
+    CONST(EPERM),
+    CONST(EPFNOSUPPORT),
+    CONST(EPIPE),
+    CONST(EPROCLIM),
+    CONST(EPROCUNAVAIL),
+    CONST(EPROGMISMATCH),
+    CONST(EPROGUNAVAIL),
+    CONST(EPROTO),
+    CONST(EPROTONOSUPPORT),
+    CONST(EPROTOTYPE),
+    CONST(ERANGE),
+    CONST(EREMCHG),
+    CONST(EREMOTE),
+    CONST(EREMOTEIO),
+    CONST(ERESTART),
+    CONST(EROFS),
+    CONST(ERPCMISMATCH),
+    CONST(ESHUTDOWN),
+    CONST(ESOCKTNOSUPPORT),
+    CONST(ESPIPE),
+    CONST(ESRCH),
+    CONST(ESRMNT),
+    CONST(ESTALE),
+    CONST(ESTRPIPE),
+    CONST(ETIME),
+    CONST(ETIMEDOUT),
+    CONST(ETOOMANYREFS),
+    CONST(ETXTBSY),
+    CONST(EUCLEAN),
+    CONST(EUNATCH),
+    CONST(EUSERS),
+    CONST(EWOULDBLOCK),
+    CONST(EXDEV),
+    CONST(EXFULL),
+    { NULL, 0 }
+};
+
+/* The enumerations, in the order they appear in PyGpgmeModState */
+static const struct {
+    PyGpgmeEnumDef def;
+    size_t offset;
+} enum_defs[] = {
+#define ENUM(name, base, values) \
+    { { #name, base, values }, offsetof(PyGpgmeModState, name) }
+    ENUM(DataEncoding, "IntEnum", data_encoding_values),
+    ENUM(PubkeyAlgo, "IntEnum", pubkey_algo_values),
+    ENUM(HashAlgo, "IntEnum", hash_algo_values),
+    ENUM(SigMode, "IntEnum", sig_mode_values),
+    ENUM(Validity, "IntEnum", validity_values),
+    ENUM(Protocol, "IntEnum", protocol_values),
+    ENUM(KeylistMode, "IntFlag", keylist_mode_values),
+    ENUM(PinentryMode, "IntEnum", pinentry_mode_values),
+    ENUM(ExportMode, "IntFlag", export_mode_values),
+    ENUM(SigNotationFlags, "IntFlag", sig_notation_flags_values),
+    ENUM(Status, "IntEnum", status_values),
+    ENUM(EncryptFlags, "IntFlag", encrypt_flags_values),
+    ENUM(Sigsum, "IntFlag", sigsum_values),
+    ENUM(Import, "IntFlag", import_values),
+    ENUM(Delete, "IntFlag", delete_values),
+    ENUM(KeyFlags, "IntFlag", key_flags_values),
+    ENUM(ErrSource, "IntEnum", err_source_values),
+    ENUM(ErrCode, "IntEnum", err_code_values),
+#undef ENUM
+};
+
+static PyGpgmeEnum *
+find_enum(PyGpgmeModState *state, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(enum_defs) / sizeof(enum_defs[0]); i++) {
+        if (strcmp(enum_defs[i].def.name, name) == 0)
+            return (PyGpgmeEnum *)((char *)state + enum_defs[i].offset);
+    }
+    return NULL;
+}
+
+void
+pygpgme_init_enums(PyGpgmeModState *state)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(enum_defs) / sizeof(enum_defs[0]); i++) {
+        PyGpgmeEnum *e = (PyGpgmeEnum *)((char *)state + enum_defs[i].offset);
+
+        e->def = &enum_defs[i].def;
+    }
 }
 
+/* Resets the enumeration locks in the child after fork(), since
+ * another thread may have held one when the process forked. */
+void
+pygpgme_enums_after_fork(PyGpgmeModState *state)
+{
+#ifdef Py_GIL_DISABLED
+    size_t i;
+
+    for (i = 0; i < sizeof(enum_defs) / sizeof(enum_defs[0]); i++) {
+        PyGpgmeEnum *e = (PyGpgmeEnum *)((char *)state + enum_defs[i].offset);
+
+        e->mutex = (PyMutex){0};
+    }
+#endif
+}
+
+/* Module level __getattr__, which creates the enum classes on first
+ * access rather than at import time. */
 PyObject *
-pygpgme_enum_value_new (PyObject *type, long value)
+pygpgme_mod_getattr(PyObject *mod, PyObject *name)
+{
+    PyGpgmeModState *state = PyModule_GetState(mod);
+    PyGpgmeEnum *e;
+    PyObject *type;
+    const char *str;
+
+    str = PyUnicode_AsUTF8(name);
+    if (str == NULL)
+        return NULL;
+    e = find_enum(state, str);
+    if (e == NULL) {
+        PyErr_Format(PyExc_AttributeError,
+                     "module '%s' has no attribute '%U'",
+                     PyModule_GetName(mod), name);
+        return NULL;
+    }
+    type = pygpgme_enum_type(e);
+    if (type == NULL)
+        return NULL;
+    if (PyObject_SetAttr(mod, name, type) < 0)
+        return NULL;
+    Py_INCREF(type);
+    return type;
+}
+
+PyObject *
+pygpgme_mod_dir(PyObject *mod, PyObject *unused)
+{
+    PyObject *dict = PyModule_GetDict(mod);
+    PyObject *names;
+    size_t i;
+
+    names = PyDict_Keys(dict);
+    if (names == NULL)
+        return NULL;
+    for (i = 0; i < sizeof(enum_defs) / sizeof(enum_defs[0]); i++) {
+        PyObject *name;
+        int found;
+
+        found = PyDict_GetItemString(dict, enum_defs[i].def.name) != NULL;
+        if (found)
+            continue;
+        name = PyUnicode_FromString(enum_defs[i].def.name);
+        if (name == NULL || PyList_Append(names, name) < 0) {
+            Py_XDECREF(name);
+            Py_DECREF(names);
+            return NULL;
+        }
+        Py_DECREF(name);
+    }
+    return names;
+}
+
+PyObject *
+pygpgme_enum_value_new (PyGpgmeEnum *e, long value)
 {
     PyObject *int_value, *enum_value;
     PyObject *args[2] = { NULL, };
 
+    if (pygpgme_enum_type(e) == NULL)
+        return NULL;
+    if (value >= 0 && value < e->n_dense && e->dense[value] != NULL) {
+        Py_INCREF(e->dense[value]);
+        return e->dense[value];
+    }
+
     int_value = PyLong_FromLong(value);
+    if (int_value == NULL)
+        return NULL;
+
+    if (e->members != NULL) {
+        enum_value = PyDict_GetItemWithError(e->members, int_value);
+        if (enum_value != NULL) {
+            Py_INCREF(enum_value);
+            Py_DECREF(int_value);
+            return enum_value;
+        }
+        if (PyErr_Occurred()) {
+            Py_DECREF(int_value);
+            return NULL;
+        }
+    }
+
+    /* Not seen before: ask the enum class, falling back to a plain
+     * integer for unknown values. */
     args[1] = int_value;
-    enum_value = PyObject_Vectorcall(type, &args[1], 1 + PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
+    enum_value = PyObject_Vectorcall(e->type, &args[1], 1 + PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
     if (!enum_value && PyErr_ExceptionMatches(PyExc_ValueError)) {
         PyErr_Clear();
         Py_INCREF(int_value);
         enum_value = int_value;
     }
+    if (enum_value != NULL && e->members != NULL &&
+        PyDict_GET_SIZE(e->members) < e->cache_limit) {
+        if (PyDict_SetItem(e->members, int_value, enum_value) < 0)
+            PyErr_Clear();
+    }
     Py_DECREF(int_value);
     return enum_value;
 }
@@ -19,9 +19,15 @@
  */
 #include "pygpgme.h"
 #include <assert.h>
+#include <strings.h>
+#include <time.h>
 
-static void
-begin_allow_threads(PyGpgmeContext *self)
+static gpgme_error_t flush_status(PyGpgmeContext *self);
+static int string_arg(const char *name, PyObject *obj, int allow_none,
+                      const char **value);
+
+void
+pygpgme_begin_allow_threads(PyGpgmeContext *self)
 {
     PyThreadState *tstate;
 
@@ -31,12 +37,20 @@ begin_allow_threads(PyGpgmeContext *self)
     self->tstate = tstate;
 }
 
-static void
-end_allow_threads(PyGpgmeContext *self)
+void
+pygpgme_end_allow_threads(PyGpgmeContext *self)
 {
     assert(self->tstate != NULL);
     PyEval_RestoreThread(self->tstate);
     self->tstate = NULL;
+    if (self->n_status_pending > 0) {
+        PyObject *type, *value, *traceback;
+
+        /* the call is over, so errors can no longer be reported */
+        PyErr_Fetch(&type, &value, &traceback);
+        flush_status(self);
+        PyErr_Restore(type, value, traceback);
+    }
     PyThread_release_lock(self->mutex);
 }
 
@@ -54,6 +68,128 @@ unlock_context(PyGpgmeContext *self)
     PyThread_release_lock(self->mutex);
 }
 
+static int
+str_equal(const char *a, const char *b)
+{
+    if (a == NULL || b == NULL)
+        return a == b;
+    return strcmp(a, b) == 0;
+}
+
+/* Copies the configuration of one gpgme context to another.  This
+ * does not touch any Python objects, so may be called without the
+ * GIL, but the caller must hold the source context's lock. */
+static gpgme_error_t
+copy_context_config(gpgme_ctx_t dst, gpgme_ctx_t src)
+{
+    gpgme_protocol_t protocol = gpgme_get_protocol(src);
+    gpgme_engine_info_t info, global = NULL;
+    gpgme_error_t err;
+
+    err = gpgme_set_protocol(dst, protocol);
+    if (err)
+        return err;
+    gpgme_set_armor(dst, gpgme_get_armor(src));
+    gpgme_set_textmode(dst, gpgme_get_textmode(src));
+    gpgme_set_offline(dst, gpgme_get_offline(src));
+    gpgme_set_include_certs(dst, gpgme_get_include_certs(src));
+    err = gpgme_set_keylist_mode(dst, gpgme_get_keylist_mode(src));
+    if (err)
+        return err;
+    err = gpgme_set_pinentry_mode(dst, gpgme_get_pinentry_mode(src));
+    if (err)
+        return err;
+
+    /* Setting the engine info makes gpgme check the engine version,
+     * which spawns a process, so only copy engines that differ from
+     * the global defaults. */
+    err = gpgme_get_engine_info(&global);
+    if (err)
+        return err;
+    for (info = gpgme_ctx_get_engine_info(src); info != NULL;
+         info = info->next) {
+        gpgme_engine_info_t def;
+
+        for (def = global; def != NULL; def = def->next) {
+            if (def->protocol == info->protocol)
+                break;
+        }
+        if (def != NULL && str_equal(def->file_name, info->file_name) &&
+            str_equal(def->home_dir, info->home_dir))
+            continue;
+
+        err = gpgme_ctx_set_engine_info(dst, info->protocol,
+                                        info->file_name, info->home_dir);
+        if (err)
+            return err;
+    }
+    return GPG_ERR_NO_ERROR;
+}
+
+/* Context flags copied by clone().  Flags that the installed gpgme
+ * does not know about read back as NULL and are skipped. */
+static const char *const cloned_ctx_flags[] = {
+    "full-status",
+    "raw-description",
+    "export-session-key",
+    "override-session-key",
+    "auto-key-retrieve",
+    "auto-key-locate",
+    "request-origin",
+    "no-symkey-cache",
+    "ignore-mdc-error",
+    "trust-model",
+    "no-auto-check-trustdb",
+    "extended-edit",
+    "cert-expire",
+    "key-origin",
+    "import-filter",
+    "known-notations",
+    NULL,
+};
+
+/* Copies the signing setup and context flags of one gpgme context to
+ * another.  Like copy_context_config(), this may be called without
+ * the GIL while holding the source context's lock. */
+static gpgme_error_t
+copy_context_state(gpgme_ctx_t dst, gpgme_ctx_t src)
+{
+    gpgme_sig_notation_t notation;
+    gpgme_key_t key;
+    const char *value;
+    gpgme_error_t err;
+    int i;
+
+    for (i = 0; (key = gpgme_signers_enum(src, i)) != NULL; i++) {
+        err = gpgme_signers_add(dst, key);
+        gpgme_key_unref(key);
+        if (err)
+            return err;
+    }
+    for (notation = gpgme_sig_notation_get(src); notation != NULL;
+         notation = notation->next) {
+        err = gpgme_sig_notation_add(dst, notation->name, notation->value,
+                                     notation->flags);
+        if (err)
+            return err;
+    }
+    value = gpgme_get_sender(src);
+    if (value != NULL) {
+        err = gpgme_set_sender(dst, value);
+        if (err)
+            return err;
+    }
+    for (i = 0; cloned_ctx_flags[i] != NULL; i++) {
+        value = gpgme_get_ctx_flag(src, cloned_ctx_flags[i]);
+        if (value == NULL || value[0] == '\0')
+            continue;
+        err = gpgme_set_ctx_flag(dst, cloned_ctx_flags[i], value);
+        if (err)
+            return err;
+    }
+    return GPG_ERR_NO_ERROR;
+}
+
 static gpgme_error_t
 pygpgme_passphrase_cb(void *hook, const char *uid_hint,
                       const char *passphrase_info, int prev_was_bad,
@@ -76,12 +212,68 @@ pygpgme_passphrase_cb(void *hook, const char *uid_hint,
     return err;
 }
 
+static double
+monotonic_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Decides whether progress_cb should see an event.  Events that start
+ * a new stage or finish one are always passed on.  Called with the
+ * context's lock held. */
+static int
+progress_due(PyGpgmeContext *self, int new_stage, int current, int total)
+{
+    int percent = total > 0 ? (int)((long long)current * 100 / total) : -1;
+    double now;
+
+    if (self->progress_interval <= 0 && self->progress_step <= 0)
+        return 1;
+
+    now = monotonic_time();
+    if (new_stage || (total > 0 && current >= total) ||
+        percent < self->progress_last_percent ||
+        (self->progress_interval > 0 &&
+         now - self->progress_last_time >= self->progress_interval) ||
+        (self->progress_step > 0 && percent >= 0 &&
+         percent - self->progress_last_percent >= self->progress_step)) {
+        self->progress_last_time = now;
+        self->progress_last_percent = percent;
+        return 1;
+    }
+    return 0;
+}
+
 static void
 pygpgme_progress_cb(void *hook, const char *what, int type,
                     int current, int total)
 {
     PyGpgmeContext *self = hook;
     PyObject *ret;
+    int new_stage;
+
+    PyThread_acquire_lock(self->progress_lock, WAIT_LOCK);
+    new_stage = !self->progress.recorded || self->progress.type != type ||
+        self->progress.has_what != (what != NULL) ||
+        (what != NULL && strncmp(self->progress.what, what,
+                                 sizeof(self->progress.what) - 1) != 0);
+    self->progress.recorded = 1;
+    self->progress.has_what = what != NULL;
+    if (what != NULL) {
+        strncpy(self->progress.what, what, sizeof(self->progress.what) - 1);
+        self->progress.what[sizeof(self->progress.what) - 1] = '\0';
+    }
+    self->progress.type = type;
+    self->progress.current = current;
+    self->progress.total = total;
+    PyThread_release_lock(self->progress_lock);
+
+    if (self->progress_cb == NULL ||
+        !progress_due(self, new_stage, current, total))
+        return;
 
     assert(self->tstate != NULL);
     PyEval_RestoreThread(self->tstate);
@@ -91,16 +283,174 @@ pygpgme_progress_cb(void *hook, const char *what, int type,
     self->tstate = PyEval_SaveThread();
 }
 
+struct pygpgme_status_filter {
+    char *keyword;
+    int code;
+};
+
+struct pygpgme_status_line {
+    int code;
+    char *args;
+};
+
+static void
+clear_status_pending(PyGpgmeContext *self)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < self->n_status_pending; i++)
+        PyMem_RawFree(self->status_pending[i].args);
+    self->n_status_pending = 0;
+}
+
+static void
+free_status_filter(struct pygpgme_status_filter *filter, Py_ssize_t length)
+{
+    Py_ssize_t i;
+
+    if (filter == NULL)
+        return;
+    for (i = 0; i < length; i++)
+        PyMem_Free(filter[i].keyword);
+    PyMem_Free(filter);
+}
+
+static PyObject *
+status_args(const char *args)
+{
+    if (args == NULL)
+        Py_RETURN_NONE;
+    return PyUnicode_DecodeUTF8(args, strlen(args), "replace");
+}
+
+/* Passes the queued status lines to status_cb as a list.  Called with
+ * the GIL and the context's lock held. */
+static gpgme_error_t
+flush_status(PyGpgmeContext *self)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    PyObject *lines, *ret = NULL;
+    Py_ssize_t i;
+    gpgme_error_t err;
+
+    lines = PyList_New(self->n_status_pending);
+    for (i = 0; lines != NULL && i < self->n_status_pending; i++) {
+        struct pygpgme_status_line *line = &self->status_pending[i];
+        PyObject *item;
+
+        item = Py_BuildValue("(NN)",
+                             pygpgme_enum_value_new(&state->Status, line->code),
+                             status_args(line->args));
+        if (item == NULL)
+            Py_CLEAR(lines);
+        else
+            PyList_SET_ITEM(lines, i, item);
+    }
+    clear_status_pending(self);
+    if (lines != NULL) {
+        ret = PyObject_CallFunctionObjArgs(self->status_cb, lines, NULL);
+        Py_DECREF(lines);
+    }
+    err = pygpgme_check_pyerror(state);
+    Py_XDECREF(ret);
+    return err;
+}
+
+static gpgme_error_t
+pygpgme_status_cb(void *hook, const char *keyword, const char *args)
+{
+    PyGpgmeContext *self = hook;
+    PyGpgmeModState *state;
+    PyObject *status, *py_args, *ret;
+    gpgme_error_t err;
+    Py_ssize_t i;
+    int code = -1;
+
+    /* filter without the GIL, so unwanted lines cost very little */
+    for (i = 0; i < self->n_status_filter; i++) {
+        if (strcmp(self->status_filter[i].keyword, keyword) == 0) {
+            code = self->status_filter[i].code;
+            break;
+        }
+    }
+    if (code < 0)
+        return GPG_ERR_NO_ERROR;
+
+    if (self->status_batch > 0) {
+        struct pygpgme_status_line *line;
+
+        line = &self->status_pending[self->n_status_pending];
+        line->code = code;
+        line->args = NULL;
+        if (args != NULL) {
+            size_t length = strlen(args) + 1;
+
+            line->args = PyMem_RawMalloc(length);
+            if (line->args == NULL)
+                return gpgme_error(GPG_ERR_ENOMEM);
+            memcpy(line->args, args, length);
+        }
+        self->n_status_pending++;
+        if (self->n_status_pending < self->status_batch)
+            return GPG_ERR_NO_ERROR;
+
+        assert(self->tstate != NULL);
+        PyEval_RestoreThread(self->tstate);
+        err = flush_status(self);
+        self->tstate = PyEval_SaveThread();
+        return err;
+    }
+
+    assert(self->tstate != NULL);
+    PyEval_RestoreThread(self->tstate);
+    state = PyType_GetModuleState(Py_TYPE(self));
+    status = pygpgme_enum_value_new(&state->Status, code);
+    py_args = status_args(args);
+    ret = NULL;
+    if (status != NULL && py_args != NULL)
+        ret = PyObject_CallFunctionObjArgs(self->status_cb, status, py_args,
+                                           NULL);
+    Py_XDECREF(status);
+    Py_XDECREF(py_args);
+    err = pygpgme_check_pyerror(state);
+    Py_XDECREF(ret);
+    self->tstate = PyEval_SaveThread();
+    return err;
+}
+
+/* Forgets the settings saved by apply_profile(). */
+static void
+clear_profile_saved(PyGpgmeContext *self)
+{
+    int n;
+
+    for (n = 0; n < PYGPGME_PROFILE_SETTINGS; n++) {
+        PyMem_Free(self->profile_saved.flags[n]);
+        self->profile_saved.flags[n] = NULL;
+    }
+    self->profile_saved.saved = 0;
+}
+
 static void
 pygpgme_context_dealloc(PyGpgmeContext *self)
 {
+    pygpgme_fork_untrack(PyType_GetModuleState(Py_TYPE(self)),
+                         &self->fork_link);
     if (self->ctx) {
         gpgme_release(self->ctx);
     }
     self->ctx = NULL;
     PyThread_free_lock(self->mutex);
+    if (self->progress_lock)
+        PyThread_free_lock(self->progress_lock);
     Py_XDECREF(self->passphrase_cb);
     Py_XDECREF(self->progress_cb);
+    pygpgme_passphrase_provider_free(self->passphrase_provider);
+    Py_XDECREF(self->status_cb);
+    free_status_filter(self->status_filter, self->n_status_filter);
+    clear_status_pending(self);
+    PyMem_Free(self->status_pending);
+    clear_profile_saved(self);
     PyObject_Del(self);
 }
 
@@ -120,6 +470,14 @@ pygpgme_context_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
         type->tp_free(self);
         return NULL;
     }
+    self->progress_lock = PyThread_allocate_lock();
+    if (!self->progress_lock) {
+        PyErr_NoMemory();
+        PyThread_free_lock(self->mutex);
+        type->tp_free(self);
+        return NULL;
+    }
+    self->progress_last_percent = -1;
 
     return (PyObject *)self;
 }
@@ -140,6 +498,7 @@ pygpgme_context_init(PyGpgmeContext *self, PyObject *args, PyObject *kwargs)
 
     if (pygpgme_check_error(state, gpgme_new(&self->ctx)))
         return -1;
+    pygpgme_fork_track(state, &self->fork_link, (PyObject *)self);
 
     return 0;
 }
@@ -157,7 +516,7 @@ pygpgme_context_get_protocol(PyGpgmeContext *self)
     protocol = gpgme_get_protocol(self->ctx);
     unlock_context(self);
 
-    return pygpgme_enum_value_new(state->Protocol_Type, protocol);
+    return pygpgme_enum_value_new(&state->Protocol, protocol);
 }
 
 static int
@@ -349,7 +708,7 @@ pygpgme_context_get_keylist_mode(PyGpgmeContext *self)
     mode = gpgme_get_keylist_mode(self->ctx);
     unlock_context(self);
 
-    return pygpgme_enum_value_new(state->KeylistMode_Type, mode);
+    return pygpgme_enum_value_new(&state->KeylistMode, mode);
 }
 
 static int
@@ -391,7 +750,7 @@ pygpgme_context_get_pinentry_mode(PyGpgmeContext *self)
     mode = gpgme_get_pinentry_mode(self->ctx);
     unlock_context(self);
 
-    return pygpgme_enum_value_new(state->PinentryMode_Type, mode);
+    return pygpgme_enum_value_new(&state->PinentryMode, mode);
 }
 
 static int
@@ -466,6 +825,8 @@ pygpgme_context_set_passphrase_cb(PyGpgmeContext *self, PyObject *value)
 
     lock_context(self);
     Py_CLEAR(self->passphrase_cb);
+    pygpgme_passphrase_provider_free(self->passphrase_provider);
+    self->passphrase_provider = NULL;
     if (value != NULL) {
         Py_INCREF(value);
         self->passphrase_cb = value;
@@ -478,6 +839,89 @@ pygpgme_context_set_passphrase_cb(PyGpgmeContext *self, PyObject *value)
     return 0;
 }
 
+/* Replaces any passphrase callback with the given provider, which the
+ * context takes ownership of. */
+static void
+set_passphrase_provider(PyGpgmeContext *self,
+                        PyGpgmePassphraseProvider *provider)
+{
+    lock_context(self);
+    Py_CLEAR(self->passphrase_cb);
+    pygpgme_passphrase_provider_free(self->passphrase_provider);
+    self->passphrase_provider = provider;
+    if (provider != NULL)
+        gpgme_set_passphrase_cb(self->ctx, pygpgme_passphrase_provider_cb,
+                                provider);
+    else
+        gpgme_set_passphrase_cb(self->ctx, NULL, NULL);
+    unlock_context(self);
+}
+
+static const char pygpgme_context_set_passphrase_doc[] =
+    "set_passphrase($self, passphrase, /)\n"
+    "--\n\n"
+    "Answer passphrase requests without calling into Python.\n"
+    "\n"
+    "This replaces :attr:`passphrase_cb`.  The passphrase is written to\n"
+    "gpg directly, without taking the global interpreter lock, which\n"
+    "helps when many threads decrypt or sign in parallel.  A passphrase\n"
+    "that gpg rejects is not offered again; the operation fails with\n"
+    "``ErrCode.BAD_PASSPHRASE`` instead.\n"
+    "\n"
+    "Args:\n"
+    "  passphrase (str | bytes | Mapping[str, str | bytes] | None): the\n"
+    "    passphrase to use for every key, or a mapping from 16 digit key\n"
+    "    IDs, fingerprints or user IDs to passphrases.  Keys not found in\n"
+    "    the mapping fail with ``ErrCode.NO_PASSPHRASE``.  None removes\n"
+    "    the provider.\n"
+    "\n"
+    "Raises:\n"
+    "  ValueError: a passphrase contains a newline, or a mapping key is\n"
+    "    a short (8 digit) key ID.\n";
+
+static PyObject *
+pygpgme_context_set_passphrase(PyGpgmeContext *self, PyObject *passphrase)
+{
+    PyGpgmePassphraseProvider *provider = NULL;
+
+    if (passphrase != Py_None) {
+        provider = pygpgme_passphrase_provider_new(passphrase);
+        if (provider == NULL)
+            return NULL;
+    }
+    set_passphrase_provider(self, provider);
+    Py_RETURN_NONE;
+}
+
+static const char pygpgme_context_set_passphrase_keyring_doc[] =
+    "set_passphrase_keyring($self, prefix, /)\n"
+    "--\n\n"
+    "Answer passphrase requests from the Linux kernel keyring.\n"
+    "\n"
+    "Like :meth:`set_passphrase`, but the passphrase is read when gpg\n"
+    "asks for it from the ``user`` key whose description is the prefix\n"
+    "followed by the 16 digit key ID of the primary key, such as one\n"
+    "added with ``keyctl add user gpg:54DCBBC8DBFB9EB3 secret @u``.\n"
+    "The usual keyrings of the calling thread are searched.\n"
+    "\n"
+    "Args:\n"
+    "  prefix (str): the prefix of the key descriptions.\n"
+    "\n"
+    "Raises:\n"
+    "  NotImplementedError: the kernel keyring is not available.\n";
+
+static PyObject *
+pygpgme_context_set_passphrase_keyring(PyGpgmeContext *self, PyObject *prefix)
+{
+    PyGpgmePassphraseProvider *provider;
+
+    provider = pygpgme_passphrase_keyring_new(prefix);
+    if (provider == NULL)
+        return NULL;
+    set_passphrase_provider(self, provider);
+    Py_RETURN_NONE;
+}
+
 static PyObject *
 pygpgme_context_get_progress_cb(PyGpgmeContext *self)
 {
@@ -487,36 +931,685 @@ pygpgme_context_get_progress_cb(PyGpgmeContext *self)
     lock_context(self);
     gpgme_get_progress_cb(self->ctx, &progress_cb, NULL);
     /* Check to make sure it is a Python callback */
-    if (progress_cb == pygpgme_progress_cb) {
+    if (progress_cb == pygpgme_progress_cb && self->progress_cb != NULL) {
         callback = self->progress_cb;
     } else {
         callback = Py_None;
     }
-    Py_INCREF(callback);
-    unlock_context(self);
-
-    return callback;
+    Py_INCREF(callback);
+    unlock_context(self);
+
+    return callback;
+}
+
+static int
+pygpgme_context_set_progress_cb(PyGpgmeContext *self, PyObject *value)
+{
+    /* callback of None == unset */
+    if (value == Py_None)
+        value = NULL;
+
+    lock_context(self);
+    Py_CLEAR(self->progress_cb);
+    if (value != NULL) {
+        Py_INCREF(value);
+        self->progress_cb = value;
+    }
+    /* events are still recorded for progress_snapshot() if a
+     * throttle has been set */
+    if (value != NULL || self->progress_tracking) {
+        gpgme_set_progress_cb(self->ctx, pygpgme_progress_cb, self);
+    } else {
+        gpgme_set_progress_cb(self->ctx, NULL, NULL);
+    }
+    unlock_context(self);
+
+    return 0;
+}
+
+static const char pygpgme_context_set_progress_throttle_doc[] =
+    "set_progress_throttle($self, interval=0.0, step=0)\n"
+    "--\n\n"
+    "Limit how often :attr:`progress_cb` is called.\n"
+    "\n"
+    "Progress events are recorded without calling into Python, and the\n"
+    "callback only sees an event if interval seconds have passed or the\n"
+    "operation has advanced by step percent since it was last called.\n"
+    "The first event of each stage and the final one are always passed\n"
+    "on.  With both arguments zero, every event is passed on.\n"
+    "\n"
+    "After this has been called, :meth:`progress_snapshot` works even\n"
+    "if no callback is set.\n"
+    "\n"
+    "Args:\n"
+    "  interval (float): minimum number of seconds between calls.\n"
+    "  step (int): minimum change in percent complete between calls.\n";
+
+static PyObject *
+pygpgme_context_set_progress_throttle(PyGpgmeContext *self, PyObject *args,
+                                      PyObject *kwargs)
+{
+    static char *kwlist[] = { "interval", "step", NULL };
+    double interval = 0.0;
+    int step = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|di", kwlist,
+                                     &interval, &step))
+        return NULL;
+    if (interval < 0 || step < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "interval and step must not be negative");
+        return NULL;
+    }
+
+    lock_context(self);
+    self->progress_interval = interval;
+    self->progress_step = step;
+    self->progress_last_time = 0.0;
+    self->progress_last_percent = -1;
+    self->progress_tracking = 1;
+    gpgme_set_progress_cb(self->ctx, pygpgme_progress_cb, self);
+    unlock_context(self);
+
+    Py_RETURN_NONE;
+}
+
+static const char pygpgme_context_set_status_cb_doc[] =
+    "set_status_cb($self, callback, statuses=None, batch=0)\n"
+    "--\n\n"
+    "Pass status lines from gpg to a callback.\n"
+    "\n"
+    "Only lines for the given status codes are passed on; the others are\n"
+    "dropped without calling into Python.  The callable must have the\n"
+    "following signature:\n"
+    "\n"
+    "    callback(status, args)\n"
+    "\n"
+    "where status is a :class:`Status` and args the rest of the line as\n"
+    "a string, or None.  If batch is given, lines are collected instead\n"
+    "and the callback is called with a list of (status, args) tuples\n"
+    "once batch lines are waiting, and again with any remaining lines\n"
+    "when the call into gpgme returns.  Exceptions raised by that final\n"
+    "call are ignored; others abort the operation.\n"
+    "\n"
+    "Args:\n"
+    "  callback (Callable | None): the callback, or None to stop passing\n"
+    "    on status lines.\n"
+    "  statuses (Iterable[Status] | None): the status codes to pass on.\n"
+    "    Required, and must not be empty, unless callback is None.\n"
+    "  batch (int): number of lines to collect before calling callback,\n"
+    "    or 0 to call it for every line.\n";
+
+static PyObject *
+pygpgme_context_set_status_cb(PyGpgmeContext *self, PyObject *args,
+                              PyObject *kwargs)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    static char *kwlist[] = { "callback", "statuses", "batch", NULL };
+    PyObject *callback, *statuses = NULL, *seq = NULL;
+    struct pygpgme_status_filter *filter = NULL;
+    struct pygpgme_status_line *pending = NULL;
+    Py_ssize_t i, length = 0, batch = 0;
+    gpgme_error_t err;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|On", kwlist,
+                                     &callback, &statuses, &batch))
+        return NULL;
+
+    if (callback != Py_None) {
+        if (!PyCallable_Check(callback)) {
+            PyErr_SetString(PyExc_TypeError, "callback must be callable");
+            return NULL;
+        }
+        if (batch < 0) {
+            PyErr_SetString(PyExc_ValueError, "batch must not be negative");
+            return NULL;
+        }
+        if (statuses == NULL || statuses == Py_None) {
+            PyErr_SetString(PyExc_TypeError,
+                            "statuses is required with a callback");
+            return NULL;
+        }
+        seq = PySequence_Fast(statuses, "statuses must be an iterable");
+        if (seq == NULL)
+            return NULL;
+        length = PySequence_Fast_GET_SIZE(seq);
+        if (length == 0) {
+            PyErr_SetString(PyExc_ValueError, "statuses must not be empty");
+            Py_DECREF(seq);
+            return NULL;
+        }
+        filter = PyMem_Calloc(length ? length : 1, sizeof(*filter));
+        if (batch > 0)
+            pending = PyMem_New(struct pygpgme_status_line, batch);
+        if (filter == NULL || (batch > 0 && pending == NULL)) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        for (i = 0; i < length; i++) {
+            PyObject *status, *name;
+            const char *keyword;
+            long code;
+
+            code = PyLong_AsLong(PySequence_Fast_GET_ITEM(seq, i));
+            if (code == -1 && PyErr_Occurred())
+                goto error;
+            status = pygpgme_enum_value_new(&state->Status, code);
+            if (status == NULL)
+                goto error;
+            name = PyObject_GetAttrString(status, "name");
+            Py_DECREF(status);
+            if (name == NULL) {
+                PyErr_Format(PyExc_ValueError, "unknown status code %ld",
+                             code);
+                goto error;
+            }
+            keyword = PyUnicode_AsUTF8(name);
+            if (keyword != NULL) {
+                filter[i].keyword = PyMem_Malloc(strlen(keyword) + 1);
+                if (filter[i].keyword == NULL)
+                    PyErr_NoMemory();
+                else
+                    strcpy(filter[i].keyword, keyword);
+            }
+            Py_DECREF(name);
+            if (filter[i].keyword == NULL)
+                goto error;
+            filter[i].code = code;
+        }
+        Py_DECREF(seq);
+        seq = NULL;
+    }
+
+    lock_context(self);
+    free_status_filter(self->status_filter, self->n_status_filter);
+    PyMem_Free(self->status_pending);
+    Py_CLEAR(self->status_cb);
+    self->status_filter = filter;
+    self->n_status_filter = length;
+    self->status_pending = pending;
+    self->status_batch = batch;
+    if (callback != Py_None) {
+        Py_INCREF(callback);
+        self->status_cb = callback;
+        gpgme_set_status_cb(self->ctx, pygpgme_status_cb, self);
+        /* without this, gpgme only passes on the lines it ignores */
+        err = gpgme_set_ctx_flag(self->ctx, "full-status", "1");
+    } else {
+        gpgme_set_status_cb(self->ctx, NULL, NULL);
+        err = gpgme_set_ctx_flag(self->ctx, "full-status", "");
+    }
+    unlock_context(self);
+
+    if (pygpgme_check_error(state, err))
+        return NULL;
+    Py_RETURN_NONE;
+
+ error:
+    Py_XDECREF(seq);
+    free_status_filter(filter, length);
+    PyMem_Free(pending);
+    return NULL;
+}
+
+/* Settings applied by apply_profile().  Names other than "offline"
+ * and "pinentry-mode" are gpgme context flags, which older versions
+ * of gpgme may not know about.  Settings with a NULL value are only
+ * changed when the caller gives a value.  Both profiles list the same
+ * settings in the same order, as the saved values are indexed by
+ * position. */
+struct context_setting {
+    const char *name;
+    const char *value;
+};
+
+static const struct {
+    const char *name;
+    /* put back the settings saved by the other profile, if any */
+    int restores;
+    struct context_setting settings[PYGPGME_PROFILE_SETTINGS];
+} context_profiles[] = {
+    { "default", 1, {
+        { "offline", "0" },
+        { "auto-key-retrieve", "0" },
+        { "trust-model", NULL },
+        { "no-auto-check-trustdb", "" },
+        { "no-symkey-cache", "" },
+        { "pinentry-mode", "" },
+        { NULL, NULL } } },
+    { "low-latency", 0, {
+        { "offline", "1" },
+        { "auto-key-retrieve", "0" },
+        { "trust-model", NULL },
+        { "no-auto-check-trustdb", "1" },
+        { "no-symkey-cache", "1" },
+        { "pinentry-mode", "loopback" },
+        { NULL, NULL } } },
+};
+
+static int
+is_ctx_flag(const char *name)
+{
+    return strcmp(name, "offline") != 0 && strcmp(name, "pinentry-mode") != 0;
+}
+
+/* Saves the current value of each setting a profile is about to
+ * change, unless an earlier profile has already saved it. */
+static int
+save_context_settings(PyGpgmeContext *self,
+                      const struct context_setting *settings,
+                      const char *const *values)
+{
+    int n;
+
+    if (!self->profile_saved.saved) {
+        self->profile_saved.offline = gpgme_get_offline(self->ctx);
+        self->profile_saved.pinentry_mode =
+            gpgme_get_pinentry_mode(self->ctx);
+        self->profile_saved.saved = 1;
+    }
+    for (n = 0; settings[n].name != NULL; n++) {
+        const char *value;
+        size_t length;
+
+        if (values[n] == NULL || !is_ctx_flag(settings[n].name) ||
+            self->profile_saved.flags[n] != NULL)
+            continue;
+        value = gpgme_get_ctx_flag(self->ctx, settings[n].name);
+        if (value == NULL)
+            value = "";
+        length = strlen(value);
+        self->profile_saved.flags[n] = PyMem_Malloc(length + 1);
+        if (self->profile_saved.flags[n] == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memcpy(self->profile_saved.flags[n], value, length + 1);
+    }
+    return 0;
+}
+
+static int
+copy_profile_saved(PyGpgmeContext *dst, PyGpgmeContext *src)
+{
+    int n;
+
+    dst->profile_saved.saved = src->profile_saved.saved;
+    dst->profile_saved.offline = src->profile_saved.offline;
+    dst->profile_saved.pinentry_mode = src->profile_saved.pinentry_mode;
+    for (n = 0; n < PYGPGME_PROFILE_SETTINGS; n++) {
+        const char *value = src->profile_saved.flags[n];
+
+        if (value == NULL)
+            continue;
+        dst->profile_saved.flags[n] = PyMem_Malloc(strlen(value) + 1);
+        if (dst->profile_saved.flags[n] == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        strcpy(dst->profile_saved.flags[n], value);
+    }
+    return 0;
+}
+
+static gpgme_error_t
+restore_context_setting(PyGpgmeContext *self,
+                        const struct context_setting *settings, int n)
+{
+    if (strcmp(settings[n].name, "offline") == 0) {
+        gpgme_set_offline(self->ctx, self->profile_saved.offline);
+        return GPG_ERR_NO_ERROR;
+    }
+    if (strcmp(settings[n].name, "pinentry-mode") == 0)
+        return gpgme_set_pinentry_mode(self->ctx,
+                                       self->profile_saved.pinentry_mode);
+    return gpgme_set_ctx_flag(self->ctx, settings[n].name,
+                              self->profile_saved.flags[n]);
+}
+
+static gpgme_error_t
+apply_context_setting(gpgme_ctx_t ctx, const char *name, const char *value)
+{
+    if (strcmp(name, "offline") == 0) {
+        gpgme_set_offline(ctx, value[0] == '1');
+        return GPG_ERR_NO_ERROR;
+    }
+    if (strcmp(name, "pinentry-mode") == 0)
+        return gpgme_set_pinentry_mode(
+            ctx, value[0] != '\0' ? GPGME_PINENTRY_MODE_LOOPBACK
+                                  : GPGME_PINENTRY_MODE_DEFAULT);
+    return gpgme_set_ctx_flag(ctx, name, value);
+}
+
+static const char pygpgme_context_apply_profile_doc[] =
+    "apply_profile($self, profile, *, trust_model=None)\n"
+    "--\n\n"
+    "Configure the context for a use case in one step.\n"
+    "\n"
+    "The ``'low-latency'`` profile avoids work that can stall a single\n"
+    "operation for seconds: it sets :attr:`offline`, turns off\n"
+    "automatic key retrieval and trust database checks, stops\n"
+    "gpg-agent caching symmetric passphrases and selects loopback\n"
+    "pinentry.\n"
+    "\n"
+    "The trust model decides which signatures and recipients are\n"
+    "accepted, so it is only changed when ``trust_model`` is given.\n"
+    "``'direct'`` is the cheapest, as it never walks the web of trust,\n"
+    "but it only trusts keys whose owner trust has been set directly.\n"
+    "\n"
+    "The ``'default'`` profile puts back the values these settings had\n"
+    "before ``'low-latency'`` was first applied, or gpgme's defaults if\n"
+    "it has not been.\n"
+    "\n"
+    "Settings that the installed gpgme does not support are skipped.\n"
+    "\n"
+    "Args:\n"
+    "  profile (str): ``'low-latency'`` or ``'default'``.\n"
+    "  trust_model (str | None): a gpg trust model, such as\n"
+    "    ``'direct'``, to use as well.\n"
+    "\n"
+    "Returns:\n"
+    "  dict[str, bool]: for each setting changed, whether it was applied.\n";
+
+static PyObject *
+pygpgme_context_apply_profile(PyGpgmeContext *self, PyObject *const *args,
+                              Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = { "profile", "trust_model", NULL };
+    const struct context_setting *settings = NULL;
+    const char *values[PYGPGME_PROFILE_SETTINGS];
+    const char *trust_model = NULL;
+    gpgme_error_t errors[PYGPGME_PROFILE_SETTINGS];
+    int changed[PYGPGME_PROFILE_SETTINGS];
+    PyObject *argv[2], *report;
+    int restores = 0, ret = 0;
+    size_t i;
+    int n;
+
+    if (pygpgme_parse_args("apply_profile", args, nargs, kwnames, kwlist,
+                           1, 1, argv) < 0)
+        return NULL;
+    if (!PyUnicode_Check(argv[0])) {
+        PyErr_SetString(PyExc_TypeError, "profile must be a string");
+        return NULL;
+    }
+    if (argv[1] != NULL &&
+        string_arg("trust_model", argv[1], 1, &trust_model) < 0)
+        return NULL;
+    for (i = 0; i < sizeof(context_profiles) / sizeof(context_profiles[0]);
+         i++) {
+        if (PyUnicode_CompareWithASCIIString(argv[0],
+                                             context_profiles[i].name) == 0) {
+            settings = context_profiles[i].settings;
+            restores = context_profiles[i].restores;
+            break;
+        }
+    }
+    if (settings == NULL) {
+        PyErr_Format(PyExc_ValueError, "unknown profile %R", argv[0]);
+        return NULL;
+    }
+    for (n = 0; settings[n].name != NULL; n++) {
+        values[n] = settings[n].value;
+        if (trust_model != NULL && strcmp(settings[n].name, "trust-model") == 0)
+            values[n] = trust_model;
+    }
+
+    lock_context(self);
+    if (restores && self->profile_saved.saved) {
+        for (n = 0; settings[n].name != NULL; n++) {
+            changed[n] = 1;
+            if (values[n] != settings[n].value)
+                errors[n] = apply_context_setting(self->ctx, settings[n].name,
+                                                  values[n]);
+            else if (!is_ctx_flag(settings[n].name) ||
+                     self->profile_saved.flags[n] != NULL)
+                errors[n] = restore_context_setting(self, settings, n);
+            else
+                changed[n] = 0;
+        }
+        clear_profile_saved(self);
+    } else {
+        if (!restores)
+            ret = save_context_settings(self, settings, values);
+        for (n = 0; ret == 0 && settings[n].name != NULL; n++) {
+            changed[n] = values[n] != NULL;
+            if (changed[n])
+                errors[n] = apply_context_setting(self->ctx, settings[n].name,
+                                                  values[n]);
+        }
+    }
+    unlock_context(self);
+    if (ret < 0)
+        return NULL;
+
+    report = PyDict_New();
+    if (report == NULL)
+        return NULL;
+    for (n = 0; settings[n].name != NULL; n++) {
+        if (changed[n] &&
+            PyDict_SetItemString(report, settings[n].name,
+                                 errors[n] ? Py_False : Py_True) < 0) {
+            Py_DECREF(report);
+            return NULL;
+        }
+    }
+    return report;
+}
+
+/* Registers the context's callbacks with its gpgme context. */
+static void
+set_context_callbacks(PyGpgmeContext *self)
+{
+    if (self->passphrase_cb != NULL)
+        gpgme_set_passphrase_cb(self->ctx, pygpgme_passphrase_cb, self);
+    else if (self->passphrase_provider != NULL)
+        gpgme_set_passphrase_cb(self->ctx, pygpgme_passphrase_provider_cb,
+                                self->passphrase_provider);
+    if (self->progress_cb != NULL || self->progress_tracking)
+        gpgme_set_progress_cb(self->ctx, pygpgme_progress_cb, self);
+    if (self->status_cb != NULL)
+        gpgme_set_status_cb(self->ctx, pygpgme_status_cb, self);
+}
+
+/* Copies the status callback and its filter to a new context.
+ * Called with the GIL and the source context's lock held. */
+static int
+copy_status_filter(PyGpgmeContext *dst, PyGpgmeContext *src)
+{
+    Py_ssize_t i;
+
+    dst->status_filter = PyMem_Calloc(
+        src->n_status_filter ? src->n_status_filter : 1,
+        sizeof(*dst->status_filter));
+    if (dst->status_filter == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < src->n_status_filter; i++) {
+        const char *keyword = src->status_filter[i].keyword;
+
+        dst->status_filter[i].keyword = PyMem_Malloc(strlen(keyword) + 1);
+        if (dst->status_filter[i].keyword == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        strcpy(dst->status_filter[i].keyword, keyword);
+        dst->status_filter[i].code = src->status_filter[i].code;
+        dst->n_status_filter++;
+    }
+    if (src->status_batch > 0) {
+        dst->status_pending = PyMem_New(struct pygpgme_status_line,
+                                        src->status_batch);
+        if (dst->status_pending == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        dst->status_batch = src->status_batch;
+    }
+    Py_INCREF(src->status_cb);
+    dst->status_cb = src->status_cb;
+    return 0;
+}
+
+/* Copies the Python callbacks and their settings to a new context.
+ * Called with the GIL and the source context's lock held. */
+static int
+copy_context_callbacks(PyGpgmeContext *dst, PyGpgmeContext *src)
+{
+    if (src->passphrase_cb != NULL) {
+        Py_INCREF(src->passphrase_cb);
+        dst->passphrase_cb = src->passphrase_cb;
+    } else if (src->passphrase_provider != NULL) {
+        dst->passphrase_provider =
+            pygpgme_passphrase_provider_copy(src->passphrase_provider);
+        if (dst->passphrase_provider == NULL)
+            return -1;
+    }
+
+    dst->progress_tracking = src->progress_tracking;
+    dst->progress_interval = src->progress_interval;
+    dst->progress_step = src->progress_step;
+    if (src->progress_cb != NULL) {
+        Py_INCREF(src->progress_cb);
+        dst->progress_cb = src->progress_cb;
+    }
+
+    if (src->status_cb != NULL && copy_status_filter(dst, src) < 0)
+        return -1;
+    set_context_callbacks(dst);
+    return 0;
+}
+
+/* Fixes up a context in the child after fork().  See
+ * pygpgme-fork.c. */
+int
+pygpgme_context_after_fork(PyGpgmeContext *self)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    gpgme_ctx_t ctx = NULL;
+    gpgme_error_t err;
+    int busy;
+
+    /* os.fork() was called from one of this context's callbacks: the
+     * operation carries on in this thread and releases the lock
+     * itself when it returns */
+    if (self->tstate != NULL && self->tstate == PyThreadState_Get())
+        return 0;
+
+    busy = pygpgme_fork_reset_lock(&self->mutex);
+    if (busy < 0 || pygpgme_fork_reset_lock(&self->progress_lock) < 0)
+        return -1;
+    self->tstate = NULL;
+    /* an idle OpenPGP context holds no engine connection */
+    if (!busy && gpgme_get_protocol(self->ctx) == GPGME_PROTOCOL_OpenPGP)
+        return 0;
+
+    clear_status_pending(self);
+    self->progress.recorded = 0;
+    self->progress_last_time = 0.0;
+    self->progress_last_percent = -1;
+
+    /* Releasing the old gpgme context would end its engine's
+     * conversation with the parent, so it is abandoned instead. */
+    err = gpgme_new(&ctx);
+    if (err == GPG_ERR_NO_ERROR)
+        err = copy_context_config(ctx, self->ctx);
+    if (err == GPG_ERR_NO_ERROR)
+        err = copy_context_state(ctx, self->ctx);
+    if (pygpgme_check_error(state, err)) {
+        if (ctx != NULL)
+            gpgme_release(ctx);
+        return -1;
+    }
+    self->ctx = ctx;
+    set_context_callbacks(self);
+    return 0;
 }
 
-static int
-pygpgme_context_set_progress_cb(PyGpgmeContext *self, PyObject *value)
+static const char pygpgme_context_clone_doc[] =
+    "clone($self)\n"
+    "--\n\n"
+    "Create a new context with the same configuration.\n"
+    "\n"
+    "The new context has its own gpgme context, so it can run\n"
+    "operations in another thread at the same time as this one.  The\n"
+    "protocol, engine info, flags such as :attr:`armor` and\n"
+    ":attr:`offline`, the signers, signature notations, sender and\n"
+    "context flags are copied, and the callbacks and passphrase set\n"
+    "with :meth:`set_passphrase` are shared.  The locale and any\n"
+    "progress or operation state are not copied.\n"
+    "\n"
+    "Returns:\n"
+    "  Context: the new context.\n";
+
+static PyObject *
+pygpgme_context_clone(PyGpgmeContext *self, PyObject *unused)
 {
-    /* callback of None == unset */
-    if (value == Py_None)
-        value = NULL;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    PyGpgmeContext *clone;
+    gpgme_error_t err;
+    int ret;
 
-    lock_context(self);
-    Py_CLEAR(self->progress_cb);
-    if (value != NULL) {
-        Py_INCREF(value);
-        self->progress_cb = value;
-        gpgme_set_progress_cb(self->ctx, pygpgme_progress_cb, self);
-    } else {
-        gpgme_set_progress_cb(self->ctx, NULL, NULL);
+    clone = (PyGpgmeContext *)PyObject_CallNoArgs((PyObject *)Py_TYPE(self));
+    if (clone == NULL)
+        return NULL;
+
+    pygpgme_begin_allow_threads(self);
+    err = copy_context_config(clone->ctx, self->ctx);
+    if (err == GPG_ERR_NO_ERROR)
+        err = copy_context_state(clone->ctx, self->ctx);
+    pygpgme_end_allow_threads(self);
+    if (pygpgme_check_error(state, err)) {
+        Py_DECREF(clone);
+        return NULL;
     }
+
+    lock_context(self);
+    ret = copy_context_callbacks(clone, self);
+    if (ret == 0)
+        ret = copy_profile_saved(clone, self);
     unlock_context(self);
+    if (ret < 0) {
+        Py_DECREF(clone);
+        return NULL;
+    }
+    return (PyObject *)clone;
+}
 
-    return 0;
+static const char pygpgme_context_progress_snapshot_doc[] =
+    "progress_snapshot($self)\n"
+    "--\n\n"
+    "Return the most recent progress event.\n"
+    "\n"
+    "This may be called from another thread while an operation is\n"
+    "running.  Events are only recorded while :attr:`progress_cb` is\n"
+    "set or after :meth:`set_progress_throttle` has been called.\n"
+    "\n"
+    "Returns:\n"
+    "  tuple[str | None, int, int, int] | None: the (what, type, current,\n"
+    "  total) arguments of the last event, or None if there has been\n"
+    "  none.\n";
+
+static PyObject *
+pygpgme_context_progress_snapshot(PyGpgmeContext *self)
+{
+    char what[sizeof(self->progress.what)];
+    int recorded, has_what, type, current, total;
+
+    PyThread_acquire_lock(self->progress_lock, WAIT_LOCK);
+    recorded = self->progress.recorded;
+    has_what = self->progress.has_what;
+    memcpy(what, self->progress.what, sizeof(what));
+    type = self->progress.type;
+    current = self->progress.current;
+    total = self->progress.total;
+    PyThread_release_lock(self->progress_lock);
+
+    if (!recorded)
+        Py_RETURN_NONE;
+    return Py_BuildValue("(ziii)", has_what ? what : NULL,
+                         type, current, total);
 }
 
 static const char pygpgme_context_signers_doc[] =
@@ -715,6 +1808,104 @@ pygpgme_context_set_sender(PyGpgmeContext *self, PyObject *value)
     return pygpgme_check_error(state, err);
 }
 
+static const char pygpgme_context_export_session_key_doc[] =
+    "Whether :meth:`decrypt` should report the session key of the message\n"
+    "in :attr:`DecryptResult.session_key`.";
+
+static PyObject *
+pygpgme_context_get_export_session_key(PyGpgmeContext *self)
+{
+    const char *value;
+    int enabled;
+
+    lock_context(self);
+    value = gpgme_get_ctx_flag(self->ctx, "export-session-key");
+    enabled = value != NULL && value[0] != '\0' && strcmp(value, "0") != 0;
+    unlock_context(self);
+
+    return PyBool_FromLong(enabled);
+}
+
+static int
+pygpgme_context_set_export_session_key(PyGpgmeContext *self, PyObject *value)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    gpgme_error_t err;
+    int enabled;
+
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "Can not delete attribute");
+        return -1;
+    }
+
+    enabled = PyObject_IsTrue(value);
+    if (enabled < 0)
+        return -1;
+
+    lock_context(self);
+    err = gpgme_set_ctx_flag(self->ctx, "export-session-key",
+                             enabled ? "1" : "");
+    unlock_context(self);
+
+    return pygpgme_check_error(state, err);
+}
+
+static const char pygpgme_context_override_session_key_doc[] =
+    "A session key, as returned in :attr:`DecryptResult.session_key`,\n"
+    "used to decrypt instead of the recipient's secret key.\n"
+    "\n"
+    "This skips the public key step of decryption, so the agent is not\n"
+    "involved at all.  Set to ``None`` to decrypt normally again.";
+
+static PyObject *
+pygpgme_context_get_override_session_key(PyGpgmeContext *self)
+{
+    const char *value;
+    PyObject *ret;
+
+    lock_context(self);
+    value = gpgme_get_ctx_flag(self->ctx, "override-session-key");
+    if (value == NULL || value[0] == '\0') {
+        Py_INCREF(Py_None);
+        ret = Py_None;
+    } else {
+        ret = PyUnicode_FromString(value);
+    }
+    unlock_context(self);
+
+    return ret;
+}
+
+static int
+pygpgme_context_set_override_session_key(PyGpgmeContext *self,
+                                         PyObject *value)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    const char *session_key;
+    gpgme_error_t err;
+
+    if (value == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "Can not delete attribute");
+        return -1;
+    } else if (value == Py_None) {
+        session_key = "";
+    } else if (PyUnicode_Check(value)) {
+        session_key = PyUnicode_AsUTF8AndSize(value, NULL);
+        if (session_key == NULL)
+            return -1;
+    } else {
+        PyErr_SetString(PyExc_TypeError,
+                        "override_session_key must be a string or None");
+        return -1;
+    }
+
+    lock_context(self);
+    err = gpgme_set_ctx_flag(self->ctx, "override-session-key", session_key);
+    unlock_context(self);
+
+    return pygpgme_check_error(state, err);
+}
+
 static PyGetSetDef pygpgme_context_getsets[] = {
     { "protocol", (getter)pygpgme_context_get_protocol,
       (setter)pygpgme_context_set_protocol,
@@ -751,6 +1942,13 @@ static PyGetSetDef pygpgme_context_getsets[] = {
     { "sender", (getter)pygpgme_context_get_sender,
       (setter)pygpgme_context_set_sender,
       pygpgme_context_sender_doc },
+    { "export_session_key", (getter)pygpgme_context_get_export_session_key,
+      (setter)pygpgme_context_set_export_session_key,
+      pygpgme_context_export_session_key_doc },
+    { "override_session_key",
+      (getter)pygpgme_context_get_override_session_key,
+      (setter)pygpgme_context_set_override_session_key,
+      pygpgme_context_override_session_key_doc },
     { NULL, (getter)0, (setter)0 }
 };
 
@@ -837,8 +2035,78 @@ pygpgme_context_set_locale(PyGpgmeContext *self, PyObject *args)
     Py_RETURN_NONE;
 }
 
+/* Converters for arguments parsed with pygpgme_parse_args(). */
+static int
+int_arg(PyObject *obj, int *value)
+{
+    long result = PyLong_AsLong(obj);
+
+    if (result == -1 && PyErr_Occurred())
+        return -1;
+    if (result < INT_MIN || result > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError,
+                        "Python int too large to convert to C int");
+        return -1;
+    }
+    *value = (int)result;
+    return 0;
+}
+
+static int
+long_arg(PyObject *obj, long *value)
+{
+    long result = PyLong_AsLong(obj);
+
+    if (result == -1 && PyErr_Occurred())
+        return -1;
+    *value = result;
+    return 0;
+}
+
+static int
+bool_arg(PyObject *obj, int *value)
+{
+    int result = PyObject_IsTrue(obj);
+
+    if (result < 0)
+        return -1;
+    *value = result;
+    return 0;
+}
+
+/* Converts a str argument to UTF-8.  If allow_none is set, None
+ * converts to NULL. */
+static int
+string_arg(const char *name, PyObject *obj, int allow_none,
+           const char **value)
+{
+    Py_ssize_t length;
+    const char *result;
+
+    if (allow_none && obj == Py_None) {
+        *value = NULL;
+        return 0;
+    }
+    if (!PyUnicode_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "%s must be a str%s, not %.50s",
+                     name, allow_none ? " or None" : "",
+                     Py_TYPE(obj)->tp_name);
+        return -1;
+    }
+    result = PyUnicode_AsUTF8AndSize(obj, &length);
+    if (result == NULL)
+        return -1;
+    if (strlen(result) != (size_t)length) {
+        PyErr_Format(PyExc_ValueError, "embedded null character in %s",
+                     name);
+        return -1;
+    }
+    *value = result;
+    return 0;
+}
+
 static const char pygpgme_context_get_key_doc[] =
-    "get_key($self, fingerprint, secret=False, /)\n"
+    "get_key($self, fingerprint, secret=False)\n"
     "--\n\n"
     "Finds a key with the given fingerprint (a string of hex digits) in\n"
     "the user's keyring.\n"
@@ -852,21 +2120,29 @@ static const char pygpgme_context_get_key_doc[] =
     "If no key can be found, raises :exc:`GpgmeError`.\n";
 
 static PyObject *
-pygpgme_context_get_key(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_get_key(PyGpgmeContext *self, PyObject *const *args,
+                        Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    static const char *const kwlist[] = { "fingerprint", "secret", NULL };
+    PyObject *values[2];
     const char *fpr;
     int secret = 0;
     gpgme_error_t err;
     gpgme_key_t key;
     PyObject *ret;
 
-    if (!PyArg_ParseTuple(args, "s|i", &fpr, &secret))
+    if (pygpgme_parse_args("get_key", args, nargs, kwnames, kwlist, 1, 2,
+                           values) < 0)
+        return NULL;
+    if (string_arg("fingerprint", values[0], 0, &fpr) < 0)
+        return NULL;
+    if (values[1] != NULL && int_arg(values[1], &secret) < 0)
         return NULL;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_get_key(self->ctx, fpr, &key, secret);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     if (pygpgme_check_error(state, err))
         return NULL;
@@ -902,13 +2178,7 @@ decode_encrypt_result(PyGpgmeContext *self)
     for (key = res->invalid_recipients; key != NULL; key = key->next) {
         PyObject *item, *py_fpr, *err;
 
-        if (key->fpr)
-            py_fpr = PyUnicode_DecodeASCII(key->fpr, strlen(key->fpr),
-                                           "replace");
-        else {
-            py_fpr = Py_None;
-            Py_INCREF(py_fpr);
-        }
+        py_fpr = pygpgme_intern_ascii(state, key->fpr);
         err = pygpgme_error_object(state, key->reason);
         item = Py_BuildValue("(NN)", py_fpr, err);
         PyList_Append(list, item);
@@ -922,16 +2192,81 @@ decode_encrypt_result(PyGpgmeContext *self)
     PyErr_Restore(err_type, err_value, err_traceback);
 }
 
+/* Convert the recipients argument of encrypt() and encrypt_sign() to
+ * a NULL terminated key array.  A RecipientSet is used directly;
+ * otherwise a new array is allocated and *owned is set, and the
+ * caller must free it with free_recipients(). */
+static int
+parse_recipients(PyGpgmeModState *state, PyObject *py_recp,
+                 gpgme_key_t **recp, int *owned)
+{
+    PyObject *recp_seq;
+    Py_ssize_t i, length;
+
+    *recp = NULL;
+    *owned = 0;
+
+    if (Py_IS_TYPE(py_recp, state->RecipientSet_Type)) {
+        *recp = ((PyGpgmeRecipientSet *)py_recp)->keys;
+        return 0;
+    }
+
+    recp_seq = PySequence_Fast(py_recp, "first argument must be a "
+                               "sequence or RecipientSet");
+    if (recp_seq == NULL)
+        return -1;
+
+    length = PySequence_Fast_GET_SIZE(recp_seq);
+    *recp = PyMem_New(gpgme_key_t, length + 1);
+    if (*recp == NULL) {
+        Py_DECREF(recp_seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    *owned = 1;
+    for (i = 0; i < length; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(recp_seq, i);
+
+        if (!Py_IS_TYPE(item, state->Key_Type)) {
+            PyErr_SetString(PyExc_TypeError, "items in first argument "
+                            "must be gpgme.Key objects");
+            (*recp)[i] = NULL;
+            Py_DECREF(recp_seq);
+            return -1;
+        }
+        /* the sequence may hold the only reference to the Key, and it
+         * is released before the operation runs */
+        (*recp)[i] = ((PyGpgmeKey *)item)->key;
+        gpgme_key_ref((*recp)[i]);
+    }
+    (*recp)[i] = NULL;
+    Py_DECREF(recp_seq);
+    return 0;
+}
+
+static void
+free_recipients(gpgme_key_t *recp, int owned)
+{
+    Py_ssize_t i;
+
+    if (!owned)
+        return;
+    for (i = 0; recp[i] != NULL; i++)
+        gpgme_key_unref(recp[i]);
+    PyMem_Free(recp);
+}
+
 static const char pygpgme_context_encrypt_doc[] =
-    "encrypt($self, recipients, flags, plaintext, ciphertext, /)\n"
+    "encrypt($self, recipients, flags, plaintext, ciphertext)\n"
     "--\n\n"
     "Encrypts plaintext so it can only be read by the given recipients.\n"
     "\n"
     "Args:\n"
-    "  recipients(list[Key]): A list of :class:`Key` objects. Only people in\n"
-    "    posession of the corresponding private key (for public key\n"
-    "    encryption) or passphrase (for symmetric encryption) will be able\n"
-    "    to decrypt the result.\n\n"
+    "  recipients(list[Key]): A list of :class:`Key` objects or a\n"
+    "    :class:`RecipientSet`. Only people in posession of the\n"
+    "    corresponding private key (for public key encryption) or\n"
+    "    passphrase (for symmetric encryption) will be able to decrypt\n"
+    "    the result.\n\n"
     "  flags(EncryptFlags): See GPGME docs for details.\n"
     "  plaintext(file): A file-like object opened for reading, containing\n"
     "    the data to be encrypted.\n"
@@ -941,48 +2276,39 @@ static const char pygpgme_context_encrypt_doc[] =
     "See also :meth:`encrypt_sign` and :meth:`decrypt`.\n";
 
 static PyObject *
-pygpgme_context_encrypt(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_encrypt(PyGpgmeContext *self, PyObject *const *args,
+                        Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
-    PyObject *py_recp, *py_plain, *py_cipher, *recp_seq = NULL, *result = NULL;
-    int flags, i, length;
+    static const char *const kwlist[] = { "recipients", "flags", "plaintext",
+                                          "ciphertext", NULL };
+    PyObject *values[4];
+    PyObject *py_recp, *py_plain, *py_cipher, *result = NULL;
+    int flags, recp_owned = 0;
     gpgme_key_t *recp = NULL;
     gpgme_data_t plain = NULL, cipher = NULL;
     gpgme_error_t err;
 
-    if (!PyArg_ParseTuple(args, "OiOO", &py_recp, &flags,
-                          &py_plain, &py_cipher))
+    if (pygpgme_parse_args("encrypt", args, nargs, kwnames, kwlist, 4, 4,
+                           values) < 0 ||
+        int_arg(values[1], &flags) < 0)
         goto end;
+    py_recp = values[0];
+    py_plain = values[2];
+    py_cipher = values[3];
 
-    if (py_recp != Py_None) {
-        recp_seq = PySequence_Fast(py_recp, "first argument must be a "
-                                   "sequence or None");
-        if (recp_seq == NULL)
-            goto end;
-
-        length = PySequence_Fast_GET_SIZE(recp_seq);
-        recp = malloc((length + 1) * sizeof (gpgme_key_t));
-        for (i = 0; i < length; i++) {
-            PyObject *item = PySequence_Fast_GET_ITEM(recp_seq, i);
-
-            if (!Py_IS_TYPE(item, state->Key_Type)) {
-                PyErr_SetString(PyExc_TypeError, "items in first argument "
-                                "must be gpgme.Key objects");
-                goto end;
-            }
-            recp[i] = ((PyGpgmeKey *)item)->key;
-        }
-        recp[i] = NULL;
-    }
+    if (py_recp != Py_None &&
+        parse_recipients(state, py_recp, &recp, &recp_owned))
+        goto end;
 
     if (pygpgme_data_new(state, &plain, py_plain, self))
         goto end;
     if (pygpgme_data_new(state, &cipher, py_cipher, self))
         goto end;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_encrypt(self->ctx, recp, flags, plain, cipher);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     if (pygpgme_check_error(state, err)) {
         decode_encrypt_result(self);
@@ -993,9 +2319,7 @@ pygpgme_context_encrypt(PyGpgmeContext *self, PyObject *args)
     result = Py_None;
 
  end:
-    if (recp != NULL)
-        free(recp);
-    Py_XDECREF(recp_seq);
+    free_recipients(recp, recp_owned);
     gpgme_data_release(plain);
     gpgme_data_release(cipher);
 
@@ -1003,7 +2327,7 @@ pygpgme_context_encrypt(PyGpgmeContext *self, PyObject *args)
 }
 
 static const char pygpgme_context_encrypt_sign_doc[] =
-    "encrypt_sign($self, recipients, flags, plain, cipher, /)\n"
+    "encrypt_sign($self, recipients, flags, plaintext, ciphertext)\n"
     "--\n\n"
     "Encrypt and sign plaintext.\n"
     "\n"
@@ -1011,10 +2335,11 @@ static const char pygpgme_context_encrypt_sign_doc[] =
     "all keys listed in :attr:`Context.signers`.\n"
     "\n"
     "Args:\n"
-    "  recipients(list[Key]): A list of :class:`Key` objects. Only people in\n"
-    "    posession of the corresponding private key (for public key\n"
-    "    encryption) or passphrase (for symmetric encryption) will be able\n"
-    "    to decrypt the result.\n\n"
+    "  recipients(list[Key]): A list of :class:`Key` objects or a\n"
+    "    :class:`RecipientSet`. Only people in posession of the\n"
+    "    corresponding private key (for public key encryption) or\n"
+    "    passphrase (for symmetric encryption) will be able to decrypt\n"
+    "    the result.\n\n"
     "  flags(EncryptFlags): See GPGME docs for details.\n"
     "  plaintext(file): A file-like object opened for reading, containing\n"
     "    the data to be encrypted.\n"
@@ -1027,46 +2352,39 @@ static const char pygpgme_context_encrypt_sign_doc[] =
     "See also :meth:`decrypt_verify`.\n";
 
 static PyObject *
-pygpgme_context_encrypt_sign(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_encrypt_sign(PyGpgmeContext *self, PyObject *const *args,
+                             Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
-    PyObject *py_recp, *py_plain, *py_cipher, *recp_seq = NULL, *result = NULL;
-    int flags, i, length;
+    static const char *const kwlist[] = { "recipients", "flags", "plaintext",
+                                          "ciphertext", NULL };
+    PyObject *values[4];
+    PyObject *py_recp, *py_plain, *py_cipher, *result = NULL;
+    int flags, recp_owned = 0;
     gpgme_key_t *recp = NULL;
     gpgme_data_t plain = NULL, cipher = NULL;
     gpgme_error_t err;
     gpgme_sign_result_t sign_result;
 
-    if (!PyArg_ParseTuple(args, "OiOO", &py_recp, &flags,
-                          &py_plain, &py_cipher))
+    if (pygpgme_parse_args("encrypt_sign", args, nargs, kwnames, kwlist, 4,
+                           4, values) < 0 ||
+        int_arg(values[1], &flags) < 0)
         goto end;
+    py_recp = values[0];
+    py_plain = values[2];
+    py_cipher = values[3];
 
-    recp_seq = PySequence_Fast(py_recp, "first argument must be a sequence");
-    if (recp_seq == NULL)
+    if (parse_recipients(state, py_recp, &recp, &recp_owned))
         goto end;
 
-    length = PySequence_Fast_GET_SIZE(recp_seq);
-    recp = malloc((length + 1) * sizeof (gpgme_key_t));
-    for (i = 0; i < length; i++) {
-        PyObject *item = PySequence_Fast_GET_ITEM(recp_seq, i);
-
-        if (!Py_IS_TYPE(item, state->Key_Type)) {
-            PyErr_SetString(PyExc_TypeError, "items in first argument "
-                            "must be gpgme.Key objects");
-            goto end;
-        }
-        recp[i] = ((PyGpgmeKey *)item)->key;
-    }
-    recp[i] = NULL;
-
     if (pygpgme_data_new(state, &plain, py_plain, self))
         goto end;
     if (pygpgme_data_new(state, &cipher, py_cipher, self))
         goto end;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_encrypt_sign(self->ctx, recp, flags, plain, cipher);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     sign_result = gpgme_op_sign_result(self->ctx);
 
@@ -1091,13 +2409,7 @@ pygpgme_context_encrypt_sign(PyGpgmeContext *self, PyObject *args)
         for (key = sign_result->invalid_signers; key != NULL; key = key->next) {
             PyObject *item, *py_fpr, *err;
 
-            if (key->fpr)
-                py_fpr = PyUnicode_DecodeASCII(key->fpr, strlen(key->fpr),
-                                               "replace");
-            else {
-                py_fpr = Py_None;
-                Py_INCREF(py_fpr);
-            }
+            py_fpr = pygpgme_intern_ascii(state, key->fpr);
             err = pygpgme_error_object(state, key->reason);
             item = Py_BuildValue("(NN)", py_fpr, err);
             PyList_Append(list, item);
@@ -1120,9 +2432,7 @@ pygpgme_context_encrypt_sign(PyGpgmeContext *self, PyObject *args)
         result = PyList_New(0);
 
  end:
-    if (recp != NULL)
-        free(recp);
-    Py_XDECREF(recp_seq);
+    free_recipients(recp, recp_owned);
     gpgme_data_release(plain);
     gpgme_data_release(cipher);
 
@@ -1171,7 +2481,7 @@ decode_decrypt_result(PyGpgmeContext *self)
 }
 
 static const char pygpgme_context_decrypt_doc[] =
-    "decrypt($self, cipher, plain, /)\n"
+    "decrypt($self, cipher, plain)\n"
     "--\n\n"
     "Decrypts the ciphertext and writes out the plaintext.\n"
     "\n"
@@ -1186,18 +2496,27 @@ static const char pygpgme_context_decrypt_doc[] =
     "  plain(file): A file-like object opened for writing, where the\n"
     "    decrypted data will be written.\n"
     "\n"
+    "Returns:\n"
+    "  DecryptResult: details of the decryption, including the session\n"
+    "  key if :attr:`export_session_key` is set.\n"
+    "\n"
     "See also :meth:`decrypt_verify` and :meth:`encrypt`.\n";
 
 static PyObject *
-pygpgme_context_decrypt(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_decrypt(PyGpgmeContext *self, PyObject *const *args,
+                        Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
-    PyObject *py_cipher, *py_plain;
+    static const char *const kwlist[] = { "cipher", "plain", NULL };
+    PyObject *values[2], *py_cipher, *py_plain;
     gpgme_data_t cipher, plain;
     gpgme_error_t err;
 
-    if (!PyArg_ParseTuple(args, "OO", &py_cipher, &py_plain))
+    if (pygpgme_parse_args("decrypt", args, nargs, kwnames, kwlist, 2, 2,
+                           values) < 0)
         return NULL;
+    py_cipher = values[0];
+    py_plain = values[1];
 
     if (pygpgme_data_new(state, &cipher, py_cipher, self)) {
         return NULL;
@@ -1208,9 +2527,9 @@ pygpgme_context_decrypt(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_decrypt(self->ctx, cipher, plain);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(cipher);
     gpgme_data_release(plain);
@@ -1220,11 +2539,11 @@ pygpgme_context_decrypt(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    Py_RETURN_NONE;
+    return pygpgme_decrypt_result(state, self->ctx);
 }
 
 static const char pygpgme_context_decrypt_verify_doc[] =
-    "decrypt_verify($self, cipher, plain, /)\n"
+    "decrypt_verify($self, cipher, plain)\n"
     "--\n\n"
     "Decrypt ciphertext and verify signatures.\n"
     "\n"
@@ -1245,16 +2564,21 @@ static const char pygpgme_context_decrypt_verify_doc[] =
     "See also :py:meth:`encrypt_sign`.";
 
 static PyObject *
-pygpgme_context_decrypt_verify(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_decrypt_verify(PyGpgmeContext *self, PyObject *const *args,
+                               Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
-    PyObject *py_cipher, *py_plain;
+    static const char *const kwlist[] = { "cipher", "plain", NULL };
+    PyObject *values[2], *py_cipher, *py_plain;
     gpgme_data_t cipher, plain;
     gpgme_error_t err;
     gpgme_verify_result_t result;
 
-    if (!PyArg_ParseTuple(args, "OO", &py_cipher, &py_plain))
+    if (pygpgme_parse_args("decrypt_verify", args, nargs, kwnames, kwlist, 2, 2,
+                           values) < 0)
         return NULL;
+    py_cipher = values[0];
+    py_plain = values[1];
 
     if (pygpgme_data_new(state, &cipher, py_cipher, self)) {
         return NULL;
@@ -1265,9 +2589,9 @@ pygpgme_context_decrypt_verify(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_decrypt_verify(self->ctx, cipher, plain);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(cipher);
     gpgme_data_release(plain);
@@ -1277,38 +2601,237 @@ pygpgme_context_decrypt_verify(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    result = gpgme_op_verify_result(self->ctx);
+    result = gpgme_op_verify_result(self->ctx);
+
+    /* annotate exception */
+    if (pygpgme_check_error(state, err)) {
+        PyObject *err_type, *err_value, *err_traceback;
+        PyObject *list;
+
+        PyErr_Fetch(&err_type, &err_value, &err_traceback);
+        PyErr_NormalizeException(&err_type, &err_value, &err_traceback);
+
+        if (result == NULL)
+            goto end;
+
+        if (!PyErr_GivenExceptionMatches(err_type, state->pygpgme_error))
+            goto end;
+
+        list = pygpgme_siglist_new(state, result->signatures);
+        PyObject_SetAttrString(err_value, "signatures", list);
+        Py_DECREF(list);
+    end:
+        PyErr_Restore(err_type, err_value, err_traceback);
+        return NULL;
+    }
+
+    if (result)
+        return pygpgme_siglist_new(state, result->signatures);
+    else
+        return PyList_New(0);
+}
+
+/* Settings for symmetric encryption picked by the profile argument
+ * of encrypt_symmetric() and decrypt_symmetric(). */
+struct symmetric_profile {
+    const char *name;
+    gpgme_encrypt_flags_t flags;
+    int no_symkey_cache;
+};
+
+static const struct symmetric_profile symmetric_profiles[] = {
+    { "default", 0, 0 },
+    { "low-latency", GPGME_ENCRYPT_NO_COMPRESS, 0 },
+    { "no-cache", 0, 1 },
+};
+
+static const struct symmetric_profile *
+lookup_symmetric_profile(PyObject *name)
+{
+    size_t i;
+
+    if (name == NULL)
+        return &symmetric_profiles[0];
+    if (!PyUnicode_Check(name)) {
+        PyErr_SetString(PyExc_TypeError, "profile must be a string");
+        return NULL;
+    }
+    for (i = 0; i < sizeof(symmetric_profiles) / sizeof(symmetric_profiles[0]);
+         i++) {
+        if (PyUnicode_CompareWithASCIIString(
+                name, symmetric_profiles[i].name) == 0)
+            return &symmetric_profiles[i];
+    }
+    PyErr_Format(PyExc_ValueError, "unknown profile %R", name);
+    return NULL;
+}
+
+/* Runs a symmetric encryption or decryption of an in-memory buffer.
+ * The passphrase is answered in C with loopback pinentry, and the
+ * context's own passphrase and pinentry settings are put back
+ * afterwards, so nothing in the operation needs the GIL. */
+static PyObject *
+symmetric_op(PyGpgmeContext *self, const char *fname, int encrypt,
+             PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    static const char *const kwlist[] = { "data", "passphrase", "profile",
+                                          NULL };
+    const struct symmetric_profile *profile;
+    PyGpgmePassphraseProvider *provider = NULL;
+    PyObject *values[3], *result = NULL;
+    Py_buffer input = { NULL };
+    gpgme_data_t in = NULL, out = NULL;
+    gpgme_passphrase_cb_t old_cb;
+    void *old_hook;
+    gpgme_pinentry_mode_t old_mode;
+    const char *flag;
+    int old_no_symkey_cache = 0;
+    gpgme_error_t err;
+    char *buffer;
+    size_t length;
+
+    if (pygpgme_parse_args(fname, args, nargs, kwnames, kwlist, 2, 3,
+                           values) < 0)
+        return NULL;
+    profile = lookup_symmetric_profile(values[2]);
+    if (profile == NULL)
+        return NULL;
+    if (!PyUnicode_Check(values[1]) && !PyBytes_Check(values[1])) {
+        PyErr_SetString(PyExc_TypeError, "passphrase must be str or bytes");
+        return NULL;
+    }
+
+    if (PyObject_GetBuffer(values[0], &input, PyBUF_SIMPLE) < 0)
+        return NULL;
+    provider = pygpgme_passphrase_provider_new(values[1]);
+    if (provider == NULL)
+        goto end;
+    err = gpgme_data_new_from_mem(&in, input.buf, input.len, 0);
+    if (!err)
+        err = gpgme_data_new(&out);
+    if (pygpgme_check_error(state, err))
+        goto end;
+
+    pygpgme_begin_allow_threads(self);
+    gpgme_get_passphrase_cb(self->ctx, &old_cb, &old_hook);
+    old_mode = gpgme_get_pinentry_mode(self->ctx);
+    flag = gpgme_get_ctx_flag(self->ctx, "no-symkey-cache");
+    old_no_symkey_cache = flag != NULL && flag[0] != '\0' &&
+        strcmp(flag, "0") != 0;
+
+    gpgme_set_passphrase_cb(self->ctx, pygpgme_passphrase_provider_cb,
+                            provider);
+    err = gpgme_set_pinentry_mode(self->ctx, GPGME_PINENTRY_MODE_LOOPBACK);
+    if (!err && profile->no_symkey_cache)
+        err = gpgme_set_ctx_flag(self->ctx, "no-symkey-cache", "1");
+    if (!err) {
+        if (encrypt)
+            err = gpgme_op_encrypt(self->ctx, NULL, profile->flags, in, out);
+        else
+            err = gpgme_op_decrypt(self->ctx, in, out);
+    }
+
+    gpgme_set_passphrase_cb(self->ctx, old_cb, old_hook);
+    gpgme_set_pinentry_mode(self->ctx, old_mode);
+    if (profile->no_symkey_cache && !old_no_symkey_cache)
+        gpgme_set_ctx_flag(self->ctx, "no-symkey-cache", "");
+    pygpgme_end_allow_threads(self);
 
-    /* annotate exception */
+    /* the output may hold plaintext, so wipe it whatever happened */
+    buffer = gpgme_data_release_and_get_mem(out, &length);
+    out = NULL;
     if (pygpgme_check_error(state, err)) {
-        PyObject *err_type, *err_value, *err_traceback;
-        PyObject *list;
+        if (encrypt)
+            decode_encrypt_result(self);
+        else
+            decode_decrypt_result(self);
+    } else {
+        result = PyBytes_FromStringAndSize(buffer ? buffer : "", length);
+    }
+    if (buffer != NULL) {
+        pygpgme_wipe(buffer, length);
+        gpgme_free(buffer);
+    }
 
-        PyErr_Fetch(&err_type, &err_value, &err_traceback);
-        PyErr_NormalizeException(&err_type, &err_value, &err_traceback);
+ end:
+    gpgme_data_release(in);
+    gpgme_data_release(out);
+    pygpgme_passphrase_provider_free(provider);
+    PyBuffer_Release(&input);
+    return result;
+}
 
-        if (result == NULL)
-            goto end;
+static const char pygpgme_context_encrypt_symmetric_doc[] =
+    "encrypt_symmetric($self, data, passphrase, profile='default')\n"
+    "--\n\n"
+    "Encrypt a buffer with a passphrase.\n"
+    "\n"
+    "Unlike passing no recipients to :meth:`encrypt`, the data is held\n"
+    "in memory and the passphrase is given to gpg without a Python\n"
+    "callback, so the whole operation runs without the global\n"
+    "interpreter lock.  Loopback pinentry is used for the call; the\n"
+    "context's :attr:`passphrase_cb` and :attr:`pinentry_mode` are left\n"
+    "as they were.\n"
+    "\n"
+    "The profile selects between latency and passphrase caching:\n"
+    "\n"
+    "* ``'default'`` uses gpg's settings.\n"
+    "* ``'low-latency'`` skips compression, which is usually wasted on\n"
+    "  machine generated data.\n"
+    "* ``'no-cache'`` stops gpg-agent from caching the passphrase.\n"
+    "\n"
+    "None of the profiles changes the S2K mode, digest or iteration\n"
+    "count, which can not be set per operation through gpgme; they come\n"
+    "from the ``s2k-*`` options of gpg, or for the count from\n"
+    "gpg-agent's calibration if that is not set.\n"
+    "\n"
+    "Args:\n"
+    "  data (bytes): the plaintext, or any bytes-like object.\n"
+    "  passphrase (str | bytes): the passphrase to encrypt with.\n"
+    "  profile (str): one of ``'default'``, ``'low-latency'`` or\n"
+    "    ``'no-cache'``.\n"
+    "\n"
+    "Returns:\n"
+    "  bytes: the ciphertext, armored if :attr:`armor` is set.\n"
+    "\n"
+    "See also :meth:`decrypt_symmetric`.\n";
 
-        if (!PyErr_GivenExceptionMatches(err_type, state->pygpgme_error))
-            goto end;
+static PyObject *
+pygpgme_context_encrypt_symmetric(PyGpgmeContext *self, PyObject *const *args,
+                                  Py_ssize_t nargs, PyObject *kwnames)
+{
+    return symmetric_op(self, "encrypt_symmetric", 1, args, nargs, kwnames);
+}
 
-        list = pygpgme_siglist_new(state, result->signatures);
-        PyObject_SetAttrString(err_value, "signatures", list);
-        Py_DECREF(list);
-    end:
-        PyErr_Restore(err_type, err_value, err_traceback);
-        return NULL;
-    }
+static const char pygpgme_context_decrypt_symmetric_doc[] =
+    "decrypt_symmetric($self, data, passphrase, profile='default')\n"
+    "--\n\n"
+    "Decrypt a buffer encrypted with a passphrase.\n"
+    "\n"
+    "This is the counterpart of :meth:`encrypt_symmetric`, and also\n"
+    "runs without the global interpreter lock.  Only the caching part\n"
+    "of the profile applies: unless it is ``'no-cache'``, gpg-agent may\n"
+    "answer from its cache instead of using the given passphrase.\n"
+    "\n"
+    "Args:\n"
+    "  data (bytes): the ciphertext, or any bytes-like object.\n"
+    "  passphrase (str | bytes): the passphrase to decrypt with.\n"
+    "  profile (str): one of ``'default'``, ``'low-latency'`` or\n"
+    "    ``'no-cache'``.\n"
+    "\n"
+    "Returns:\n"
+    "  bytes: the plaintext.\n";
 
-    if (result)
-        return pygpgme_siglist_new(state, result->signatures);
-    else
-        return PyList_New(0);
+static PyObject *
+pygpgme_context_decrypt_symmetric(PyGpgmeContext *self, PyObject *const *args,
+                                  Py_ssize_t nargs, PyObject *kwnames)
+{
+    return symmetric_op(self, "decrypt_symmetric", 0, args, nargs, kwnames);
 }
 
 static const char pygpgme_context_sign_doc[] =
-    "sign($self, plain, sig, sig_mode=0, /)\n"
+    "sign($self, plain, sig, sig_mode=SigMode.NORMAL)\n"
     "--\n\n"
     "Sign plaintext to certify and timestamp it.\n"
     "\n"
@@ -1327,17 +2850,24 @@ static const char pygpgme_context_sign_doc[] =
     "    for each key in :attr:`Context.signers`).\n";
 
 static PyObject *
-pygpgme_context_sign(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_sign(PyGpgmeContext *self, PyObject *const *args,
+                     Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
-    PyObject *py_plain, *py_sig;
+    static const char *const kwlist[] = { "plain", "sig", "sig_mode", NULL };
+    PyObject *values[3], *py_plain, *py_sig;
     gpgme_data_t plain, sig;
     int sig_mode = GPGME_SIG_MODE_NORMAL;
     gpgme_error_t err;
     gpgme_sign_result_t result;
 
-    if (!PyArg_ParseTuple(args, "OO|i", &py_plain, &py_sig, &sig_mode))
+    if (pygpgme_parse_args("sign", args, nargs, kwnames, kwlist, 2, 3,
+                           values) < 0)
         return NULL;
+    if (values[2] != NULL && int_arg(values[2], &sig_mode) < 0)
+        return NULL;
+    py_plain = values[0];
+    py_sig = values[1];
 
     if (pygpgme_data_new(state, &plain, py_plain, self))
         return NULL;
@@ -1347,9 +2877,9 @@ pygpgme_context_sign(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_sign(self->ctx, plain, sig, sig_mode);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(plain);
     gpgme_data_release(sig);
@@ -1375,13 +2905,7 @@ pygpgme_context_sign(PyGpgmeContext *self, PyObject *args)
         for (key = result->invalid_signers; key != NULL; key = key->next) {
             PyObject *item, *py_fpr, *err;
 
-            if (key->fpr)
-                py_fpr = PyUnicode_DecodeASCII(key->fpr, strlen(key->fpr),
-                                               "replace");
-            else {
-                py_fpr = Py_None;
-                Py_INCREF(py_fpr);
-            }
+            py_fpr = pygpgme_intern_ascii(state, key->fpr);
             err = pygpgme_error_object(state, key->reason);
             item = Py_BuildValue("(NN)", py_fpr, err);
             PyList_Append(list, item);
@@ -1405,7 +2929,7 @@ pygpgme_context_sign(PyGpgmeContext *self, PyObject *args)
 }
 
 static const char pygpgme_context_verify_doc[] =
-    "verify($self, sig, signed_text, plaintext, /)\n"
+    "verify($self, sig, signed_text, plaintext)\n"
     "--\n\n"
     "Verify signature(s) and extract plaintext.\n"
     "\n"
@@ -1428,17 +2952,23 @@ static const char pygpgme_context_verify_doc[] =
     "    error!\n";
 
 static PyObject *
-pygpgme_context_verify(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_verify(PyGpgmeContext *self, PyObject *const *args,
+                       Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
-    PyObject *py_sig, *py_signed_text, *py_plaintext;
+    static const char *const kwlist[] = { "sig", "signed_text", "plaintext",
+                                          NULL };
+    PyObject *values[3], *py_sig, *py_signed_text, *py_plaintext;
     gpgme_data_t sig, signed_text, plaintext;
     gpgme_error_t err;
     gpgme_verify_result_t result;
 
-    if (!PyArg_ParseTuple(args, "OOO", &py_sig, &py_signed_text,
-                          &py_plaintext))
+    if (pygpgme_parse_args("verify", args, nargs, kwnames, kwlist, 3, 3,
+                           values) < 0)
         return NULL;
+    py_sig = values[0];
+    py_signed_text = values[1];
+    py_plaintext = values[2];
 
     if (pygpgme_data_new(state, &sig, py_sig, self)) {
         return NULL;
@@ -1453,9 +2983,9 @@ pygpgme_context_verify(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_verify(self->ctx, sig, signed_text, plaintext);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(sig);
     gpgme_data_release(signed_text);
@@ -1491,6 +3021,165 @@ pygpgme_context_verify(PyGpgmeContext *self, PyObject *args)
         return PyList_New(0);
 }
 
+static const char pygpgme_context_verify_ok_doc[] =
+    "verify_ok($self, sig, signed_text=None, expected_signers=None,\n"
+    "          min_validity=Validity.MARGINAL)\n"
+    "--\n\n"
+    "Verify signature(s), returning only whether they are acceptable.\n"
+    "\n"
+    "A signature is acceptable if it verified without error, is not\n"
+    "marked :data:`Sigsum.RED`, has at least ``min_validity`` (and not\n"
+    ":data:`Validity.NEVER`), and was made by one of ``expected_signers``\n"
+    "if given.  No :class:`Signature` objects are created, and the\n"
+    "plaintext of a normal or cleartext signature is discarded.\n"
+    "\n"
+    "Args:\n"
+    "  sig(file): a file-like object opened for reading, containing the\n"
+    "    signature data.\n"
+    "  signed_text(file | None): the text covered by a detached signature.\n"
+    "  expected_signers(list[str | Key] | None): if given, only signatures\n"
+    "    by these signers are accepted.  Strings are compared, ignoring\n"
+    "    case, with the fingerprint reported for the signature, while a\n"
+    "    :class:`Key` matches a signature by any of its subkeys.\n"
+    "  min_validity(Validity): the minimum validity of the signature.\n"
+    "    Pass :data:`Validity.UNKNOWN` to only check that the signature\n"
+    "    is cryptographically valid, whether or not the signer is trusted.\n"
+    "Returns:\n"
+    "  VerifyVerdict: a tuple ``(ok, fpr, summary)``.  If ``ok`` is true,\n"
+    "    ``fpr`` and ``summary`` describe the acceptable signature,\n"
+    "    otherwise the first signature.\n";
+
+/* Returns 1 if the signature was made by one of the signers in the
+ * expected sequence, which holds strings and Key objects. */
+static int
+signer_matches(PyGpgmeModState *state, PyObject *expected,
+               gpgme_signature_t sig)
+{
+    Py_ssize_t i;
+
+    if (sig->fpr == NULL)
+        return 0;
+
+    for (i = 0; i < PySequence_Fast_GET_SIZE(expected); i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(expected, i);
+
+        if (Py_IS_TYPE(item, state->Key_Type)) {
+            gpgme_subkey_t subkey;
+
+            for (subkey = ((PyGpgmeKey *)item)->key->subkeys; subkey != NULL;
+                 subkey = subkey->next) {
+                if (subkey->fpr != NULL &&
+                    strcasecmp(subkey->fpr, sig->fpr) == 0)
+                    return 1;
+            }
+        } else {
+            const char *fpr = PyUnicode_AsUTF8(item);
+
+            if (fpr == NULL)
+                return -1;
+            if (strcasecmp(fpr, sig->fpr) == 0)
+                return 1;
+        }
+    }
+    return 0;
+}
+
+static PyObject *
+pygpgme_context_verify_ok(PyGpgmeContext *self, PyObject *const *args,
+                          Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    static const char *const kwlist[] = { "sig", "signed_text",
+                                          "expected_signers", "min_validity",
+                                          NULL };
+    PyObject *values[4];
+    PyObject *py_sig, *py_signed_text = Py_None, *py_expected = Py_None;
+    PyObject *expected = NULL, *ret = NULL;
+    int min_validity = GPGME_VALIDITY_MARGINAL, ok = 0;
+    gpgme_data_t sig = NULL, signed_text = NULL, plaintext = NULL;
+    gpgme_error_t err;
+    gpgme_verify_result_t result;
+    gpgme_signature_t s, chosen = NULL;
+    Py_ssize_t i;
+
+    if (pygpgme_parse_args("verify_ok", args, nargs, kwnames, kwlist, 1, 4,
+                           values) < 0)
+        return NULL;
+    if (values[3] != NULL && int_arg(values[3], &min_validity) < 0)
+        return NULL;
+    py_sig = values[0];
+    if (values[1] != NULL)
+        py_signed_text = values[1];
+    if (values[2] != NULL)
+        py_expected = values[2];
+
+    if (py_expected != Py_None) {
+        expected = PySequence_Fast(py_expected,
+                                   "expected_signers must be a sequence");
+        if (expected == NULL)
+            return NULL;
+        for (i = 0; i < PySequence_Fast_GET_SIZE(expected); i++) {
+            PyObject *item = PySequence_Fast_GET_ITEM(expected, i);
+
+            if (!PyUnicode_Check(item) && !Py_IS_TYPE(item, state->Key_Type)) {
+                PyErr_SetString(PyExc_TypeError, "expected_signers must "
+                                "contain fingerprints or gpgme.Key objects");
+                goto end;
+            }
+        }
+    }
+
+    if (pygpgme_data_new(state, &sig, py_sig, self))
+        goto end;
+    if (pygpgme_data_new(state, &signed_text, py_signed_text, self))
+        goto end;
+    if (signed_text == NULL) {
+        /* somewhere to put the plaintext we are not interested in */
+        if (pygpgme_check_error(state, gpgme_data_new(&plaintext)))
+            goto end;
+    }
+
+    pygpgme_begin_allow_threads(self);
+    err = gpgme_op_verify(self->ctx, sig, signed_text, plaintext);
+    pygpgme_end_allow_threads(self);
+
+    if (pygpgme_check_error(state, err))
+        goto end;
+
+    result = gpgme_op_verify_result(self->ctx);
+    for (s = result ? result->signatures : NULL; s != NULL; s = s->next) {
+        if (chosen == NULL)
+            chosen = s;
+        if (s->status != GPG_ERR_NO_ERROR ||
+            (s->summary & GPGME_SIGSUM_RED) != 0 ||
+            s->validity == GPGME_VALIDITY_NEVER ||
+            (int)s->validity < min_validity)
+            continue;
+        if (expected != NULL) {
+            int match = signer_matches(state, expected, s);
+
+            if (match < 0)
+                goto end;
+            if (!match)
+                continue;
+        }
+        chosen = s;
+        ok = 1;
+        break;
+    }
+    ret = pygpgme_verify_verdict_new(state, ok, chosen);
+
+ end:
+    if (sig)
+        gpgme_data_release(sig);
+    if (signed_text)
+        gpgme_data_release(signed_text);
+    if (plaintext)
+        gpgme_data_release(plaintext);
+    Py_XDECREF(expected);
+    return ret;
+}
+
 static const char pygpgme_context_import_doc[] =
     "import_($self, keydata, /)\n"
     "--\n\n";
@@ -1509,9 +3198,9 @@ pygpgme_context_import(PyGpgmeContext *self, PyObject *args)
     if (pygpgme_data_new(state, &keydata, py_keydata, self))
         return NULL;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_import(self->ctx, keydata);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(keydata);
     result = pygpgme_import_result(state, self->ctx);
@@ -1568,9 +3257,9 @@ pygpgme_context_import_keys(PyGpgmeContext *self, PyObject *args)
         keys[i] = ((PyGpgmeKey *)item)->key;
     }
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_import_keys(self->ctx, keys);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     result = pygpgme_import_result(state, self->ctx);
     if (pygpgme_check_error(state, err)) {
@@ -1715,9 +3404,9 @@ pygpgme_context_export(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_export_ext(self->ctx, (const char **)patterns, export_mode, keydata);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     if (patterns)
         free_key_patterns(patterns);
@@ -1765,9 +3454,9 @@ pygpgme_context_export_keys(PyGpgmeContext *self, PyObject *args)
     if (pygpgme_data_new(state, &keydata, py_keydata, self))
         goto out;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_export_keys(self->ctx, keys, export_mode, keydata);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     if (pygpgme_check_error(state, err))
         goto out;
@@ -1837,9 +3526,9 @@ pygpgme_context_genkey(PyGpgmeContext *self, PyObject *args)
         return NULL;
     }
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_genkey(self->ctx, parms, pubkey, seckey);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(seckey);
     gpgme_data_release(pubkey);
@@ -1881,9 +3570,9 @@ pygpgme_context_delete(PyGpgmeContext *self, PyObject *args)
     if (!PyArg_ParseTuple(args, "O!|I", state->Key_Type, &key, &flags))
         return NULL;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_delete_ext(self->ctx, key->key, flags);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     if (pygpgme_check_error(state, err))
         return NULL;
@@ -1907,7 +3596,7 @@ pygpgme_edit_cb(void *user_data, gpgme_status_code_t status,
     assert(data->self->tstate != NULL);
     PyEval_RestoreThread(data->self->tstate);
     state = PyType_GetModuleState(Py_TYPE(data->self));
-    py_status = pygpgme_enum_value_new(state->Status_Type, status);
+    py_status = pygpgme_enum_value_new(&state->Status, status);
     ret = PyObject_CallFunction(data->callback, "Ozi", py_status, args, fd);
     Py_DECREF(py_status);
     err = pygpgme_check_pyerror(state);
@@ -1939,12 +3628,12 @@ pygpgme_context_edit(PyGpgmeContext *self, PyObject *args)
     if (pygpgme_data_new(state, &out, py_out, self))
         return NULL;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     data.self = self;
     data.callback = callback;
     err = gpgme_op_edit(self->ctx, key->key,
                         pygpgme_edit_cb, (void *)&data, out);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(out);
 
@@ -1976,12 +3665,12 @@ pygpgme_context_card_edit(PyGpgmeContext *self, PyObject *args)
     if (pygpgme_data_new(state, &out, py_out, self))
         return NULL;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     data.self = self;
     data.callback = callback;
     err = gpgme_op_card_edit(self->ctx, key->key,
                              pygpgme_edit_cb, (void *)&data, out);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     gpgme_data_release(out);
 
@@ -1991,10 +3680,18 @@ pygpgme_context_card_edit(PyGpgmeContext *self, PyObject *args)
 }
 
 static const char pygpgme_context_keylist_doc[] =
-    "keylist($self, pattern=None, secret=False, /)\n"
+    "keylist($self, pattern=None, secret=False, *, can_encrypt=False,\n"
+    "        can_sign=False, exclude_expired=False, exclude_revoked=False,\n"
+    "        exclude_disabled=False, pubkey_algo=None, min_length=0,\n"
+    "        max_length=0, expires_before=0, expires_after=0,\n"
+    "        uid_domain=None)\n"
     "--\n\n"
     "Searches for keys matching the given pattern(s).\n"
     "\n"
+    "The keyword arguments filter the listed keys.  They are checked\n"
+    "before a :class:`Key` object is created, so are much cheaper than\n"
+    "filtering the results in Python.\n"
+    "\n"
     "Args:\n"
     "  pattern(str | list[str] | None): If ``None`` or not supplied, the\n"
     "    :class:`KeyIter` fetches all available keys. If a string, it\n"
@@ -2003,29 +3700,85 @@ static const char pygpgme_context_keylist_doc[] =
     "    least one of the given patterns.\n"
     "  secret(bool): If ``True``, only secret keys will be returned (like\n"
     "    'gpg -K').\n"
+    "  can_encrypt(bool): Only return keys usable for encryption.\n"
+    "  can_sign(bool): Only return keys usable for signing.\n"
+    "  exclude_expired(bool): Skip expired keys.\n"
+    "  exclude_revoked(bool): Skip revoked keys.\n"
+    "  exclude_disabled(bool): Skip disabled keys.\n"
+    "  pubkey_algo(PubkeyAlgo | None): Only return keys whose primary key\n"
+    "    uses this algorithm.\n"
+    "  min_length(int): Only return keys whose primary key is at least\n"
+    "    this many bits long.\n"
+    "  max_length(int): Only return keys whose primary key is at most\n"
+    "    this many bits long.\n"
+    "  expires_before(int): Only return keys whose primary key expires\n"
+    "    before this time (seconds since the epoch).\n"
+    "  expires_after(int): Only return keys whose primary key does not\n"
+    "    expire, or expires after this time.\n"
+    "  uid_domain(str | None): Only return keys with a user ID email\n"
+    "    address in this domain (compared case insensitively).\n"
     "Returns:\n"
     "  KeyIter: an iterator over the matching :class:`Key` objects.\n";
 
 static PyObject *
-pygpgme_context_keylist(PyGpgmeContext *self, PyObject *args)
+pygpgme_context_keylist(PyGpgmeContext *self, PyObject *const *args,
+                        Py_ssize_t nargs, PyObject *kwnames)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
-    PyObject *py_pattern = Py_None;
+    static const char *const kwlist[] = {
+        "pattern", "secret", "can_encrypt", "can_sign", "exclude_expired",
+        "exclude_revoked", "exclude_disabled", "pubkey_algo", "min_length",
+        "max_length", "expires_before", "expires_after", "uid_domain", NULL };
+    PyObject *values[13];
+    PyObject *py_pattern = Py_None, *py_pubkey_algo = Py_None;
+    const char *uid_domain = NULL;
     char **patterns = NULL;
     int secret_only = 0;
+    PyGpgmeKeyFilter filter = { 0 };
     gpgme_error_t err;
     PyGpgmeKeyIter *ret;
 
-    if (!PyArg_ParseTuple(args, "|Oi", &py_pattern, &secret_only))
+    if (pygpgme_parse_args("keylist", args, nargs, kwnames, kwlist, 0, 2,
+                           values) < 0)
+        return NULL;
+    if ((values[1] && int_arg(values[1], &secret_only) < 0) ||
+        (values[2] && bool_arg(values[2], &filter.can_encrypt) < 0) ||
+        (values[3] && bool_arg(values[3], &filter.can_sign) < 0) ||
+        (values[4] && bool_arg(values[4], &filter.exclude_expired) < 0) ||
+        (values[5] && bool_arg(values[5], &filter.exclude_revoked) < 0) ||
+        (values[6] && bool_arg(values[6], &filter.exclude_disabled) < 0) ||
+        (values[8] && int_arg(values[8], &filter.min_length) < 0) ||
+        (values[9] && int_arg(values[9], &filter.max_length) < 0) ||
+        (values[10] && long_arg(values[10], &filter.expires_before) < 0) ||
+        (values[11] && long_arg(values[11], &filter.expires_after) < 0) ||
+        (values[12] && string_arg("uid_domain", values[12], 1,
+                                  &uid_domain) < 0))
         return NULL;
+    if (values[0] != NULL)
+        py_pattern = values[0];
+    if (values[7] != NULL)
+        py_pubkey_algo = values[7];
+
+    filter.pubkey_algo = -1;
+    if (py_pubkey_algo != Py_None) {
+        filter.pubkey_algo = PyLong_AsLong(py_pubkey_algo);
+        if (PyErr_Occurred())
+            return NULL;
+    }
+    filter.active = filter.can_encrypt || filter.can_sign ||
+        filter.exclude_expired || filter.exclude_revoked ||
+        filter.exclude_disabled || filter.pubkey_algo >= 0 ||
+        filter.min_length > 0 || filter.max_length > 0 ||
+        filter.expires_before > 0 || filter.expires_after > 0 ||
+        uid_domain != NULL;
 
     if (parse_key_patterns(py_pattern, &patterns) < 0)
         return NULL;
 
-    begin_allow_threads(self);
+    pygpgme_begin_allow_threads(self);
     err = gpgme_op_keylist_ext_start(self->ctx, (const char **)patterns,
                                      secret_only, 0);
-    end_allow_threads(self);
+    pygpgme_end_allow_threads(self);
 
     if (patterns)
         free_key_patterns(patterns);
@@ -2033,15 +3786,419 @@ pygpgme_context_keylist(PyGpgmeContext *self, PyObject *args)
     if (pygpgme_check_error(state, err))
         return NULL;
 
+    if (uid_domain != NULL) {
+        /* accept both "example.org" and "@example.org" */
+        if (uid_domain[0] == '@')
+            uid_domain++;
+        filter.uid_domain = strdup(uid_domain);
+        if (filter.uid_domain == NULL) {
+            gpgme_op_keylist_end(self->ctx);
+            return PyErr_NoMemory();
+        }
+    }
+
     /* return a KeyIter object */
     ret = PyObject_New(PyGpgmeKeyIter, state->KeyIter_Type);
-    if (!ret)
+    if (!ret) {
+        free(filter.uid_domain);
+        gpgme_op_keylist_end(self->ctx);
+        return NULL;
+    }
+    Py_INCREF(self);
+    ret->ctx = self;
+    ret->data = NULL;
+    ret->filter = filter;
+    return (PyObject *)ret;
+}
+
+static const char pygpgme_context_keylist_data_doc[] =
+    "keylist_data($self, keydata, /)\n"
+    "--\n\n"
+    "Lists the keys contained in the given key data, without importing\n"
+    "them into the keyring.\n"
+    "\n"
+    "Args:\n"
+    "  keydata(file): A file-like object opened for reading, containing\n"
+    "    armored or binary key data.\n"
+    "Returns:\n"
+    "  KeyIter: an iterator over the :class:`Key` objects in the data.\n"
+    "\n"
+    "Requires GPGME >= 1.14 and GnuPG >= 2.1.14.\n";
+
+static PyObject *
+pygpgme_context_keylist_data(PyGpgmeContext *self, PyObject *args)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    PyObject *py_keydata;
+    gpgme_data_t keydata;
+    gpgme_error_t err;
+    PyGpgmeKeyIter *ret;
+
+    if (!PyArg_ParseTuple(args, "O", &py_keydata))
+        return NULL;
+
+    if (pygpgme_data_new(state, &keydata, py_keydata, self))
+        return NULL;
+
+#if GPGME_VERSION_NUMBER >= VER(1, 14, 0)
+    pygpgme_begin_allow_threads(self);
+    err = gpgme_op_keylist_from_data_start(self->ctx, keydata, 0);
+    pygpgme_end_allow_threads(self);
+#else
+    err = gpgme_error(GPG_ERR_NOT_IMPLEMENTED);
+#endif
+
+    if (pygpgme_check_error(state, err)) {
+        gpgme_data_release(keydata);
+        return NULL;
+    }
+
+    /* The KeyIter keeps the data alive until the listing is finished */
+    ret = PyObject_New(PyGpgmeKeyIter, state->KeyIter_Type);
+    if (!ret) {
+        gpgme_op_keylist_end(self->ctx);
+        gpgme_data_release(keydata);
         return NULL;
+    }
     Py_INCREF(self);
     ret->ctx = self;
+    ret->data = keydata;
+    memset(&ret->filter, 0, sizeof(ret->filter));
     return (PyObject *)ret;
 }
 
+static const char pygpgme_context_keylist_table_doc[] =
+    "keylist_table($self, pattern=None, fields=None, secret=False)\n"
+    "--\n\n"
+    "Lists keys matching the given pattern(s) in columnar form.\n"
+    "\n"
+    "Rather than creating a :class:`Key` object for each key, the\n"
+    "requested fields of every key are collected into one column per\n"
+    "field.  Numeric columns are contiguous :class:`memoryview` arrays\n"
+    "that can be passed to anything supporting the buffer protocol\n"
+    "(e.g. ``numpy.frombuffer``).  String columns are lists.\n"
+    "\n"
+    "The available fields are:\n"
+    "\n"
+    "* ``fpr``, ``keyid``: of the primary key (list of str).\n"
+    "* ``uid``: the primary user ID (list of str or None).\n"
+    "* ``timestamp``, ``expires``: creation and expiry time of the\n"
+    "  primary key (int64, 0 meaning no expiry).\n"
+    "* ``pubkey_algo``, ``length``: algorithm and size of the primary\n"
+    "  key (int32 and uint32).\n"
+    "* ``validity``: validity of the primary user ID (int32).\n"
+    "* ``owner_trust``: the owner trust (int32).\n"
+    "* ``flags``: a :class:`KeyFlags` bit mask (uint32).\n"
+    "\n"
+    "Args:\n"
+    "  pattern(str | list[str] | None): as for :meth:`keylist`.\n"
+    "  fields(list[str] | None): the fields to return, or ``None`` for\n"
+    "    all fields.\n"
+    "  secret(bool): If ``True``, only secret keys will be returned.\n"
+    "Returns:\n"
+    "  dict[str, memoryview | list]: a column for each requested field.\n";
+
+static PyObject *
+pygpgme_context_keylist_table(PyGpgmeContext *self, PyObject *args,
+                              PyObject *kwargs)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    static char *kwlist[] = { "pattern", "fields", "secret", NULL };
+    PyObject *py_pattern = Py_None, *py_fields = Py_None;
+    PyObject *fields, *result = NULL;
+    char **patterns = NULL;
+    int secret_only = 0;
+    gpgme_key_t *keys = NULL;
+    Py_ssize_t n_keys = 0, allocated = 0, i;
+    gpgme_error_t err;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOp", kwlist,
+                                     &py_pattern, &py_fields, &secret_only))
+        return NULL;
+
+    fields = pygpgme_key_table_fields(py_fields);
+    if (fields == NULL)
+        return NULL;
+
+    if (parse_key_patterns(py_pattern, &patterns) < 0) {
+        Py_DECREF(fields);
+        return NULL;
+    }
+
+    /* collect the keys without holding the GIL */
+    pygpgme_begin_allow_threads(self);
+    err = gpgme_op_keylist_ext_start(self->ctx, (const char **)patterns,
+                                     secret_only, 0);
+    while (err == GPG_ERR_NO_ERROR) {
+        gpgme_key_t key;
+
+        err = gpgme_op_keylist_next(self->ctx, &key);
+        if (err != GPG_ERR_NO_ERROR)
+            break;
+        if (n_keys == allocated) {
+            Py_ssize_t new_size = allocated ? allocated * 2 : 64;
+            gpgme_key_t *new_keys;
+
+            new_keys = realloc(keys, new_size * sizeof (gpgme_key_t));
+            if (new_keys == NULL) {
+                gpgme_key_unref(key);
+                err = gpgme_error_from_errno(ENOMEM);
+                gpgme_op_keylist_end(self->ctx);
+                break;
+            }
+            keys = new_keys;
+            allocated = new_size;
+        }
+        keys[n_keys++] = key;
+    }
+    pygpgme_end_allow_threads(self);
+
+    if (patterns)
+        free_key_patterns(patterns);
+
+    if (gpgme_err_code(err) == GPG_ERR_EOF)
+        err = GPG_ERR_NO_ERROR;
+    if (!pygpgme_check_error(state, err))
+        result = pygpgme_key_table_new(state, keys, n_keys, fields);
+
+    for (i = 0; i < n_keys; i++)
+        gpgme_key_unref(keys[i]);
+    free(keys);
+    Py_DECREF(fields);
+    return result;
+}
+
+struct keylist_worker {
+    gpgme_ctx_t ctx;
+    const char **patterns;
+    int secret_only;
+    gpgme_key_t *keys;
+    size_t n_keys, allocated;
+    gpgme_error_t err;
+    PyThread_type_lock done;
+};
+
+/* Thread body for keylist_parallel().  Runs without the GIL. */
+static void
+keylist_worker_run(void *arg)
+{
+    struct keylist_worker *worker = arg;
+    gpgme_error_t err;
+
+    err = gpgme_op_keylist_ext_start(worker->ctx, worker->patterns,
+                                     worker->secret_only, 0);
+    while (err == GPG_ERR_NO_ERROR) {
+        gpgme_key_t key;
+
+        err = gpgme_op_keylist_next(worker->ctx, &key);
+        if (err != GPG_ERR_NO_ERROR)
+            break;
+        if (worker->n_keys == worker->allocated) {
+            size_t new_size = worker->allocated ? worker->allocated * 2 : 64;
+            gpgme_key_t *new_keys;
+
+            new_keys = realloc(worker->keys, new_size * sizeof (gpgme_key_t));
+            if (new_keys == NULL) {
+                gpgme_key_unref(key);
+                err = gpgme_error_from_errno(ENOMEM);
+                gpgme_op_keylist_end(worker->ctx);
+                break;
+            }
+            worker->keys = new_keys;
+            worker->allocated = new_size;
+        }
+        worker->keys[worker->n_keys++] = key;
+    }
+    if (gpgme_err_code(err) == GPG_ERR_EOF)
+        err = GPG_ERR_NO_ERROR;
+    worker->err = err;
+    PyThread_release_lock(worker->done);
+}
+
+static const char pygpgme_context_keylist_parallel_doc[] =
+    "keylist_parallel($self, patterns, secret=False, workers=4)\n"
+    "--\n\n"
+    "Searches for keys matching the given patterns using several gpg\n"
+    "processes at once.\n"
+    "\n"
+    "The patterns are divided between up to ``workers`` internal\n"
+    "contexts configured like this one, each running its own key\n"
+    "listing in a separate thread.  Keys matched by more than one\n"
+    "pattern are only returned once.\n"
+    "\n"
+    "Args:\n"
+    "  patterns(list[str]): the patterns to search for.  A single string\n"
+    "    or ``None`` (all keys) can not be divided, and is listed by a\n"
+    "    single worker.\n"
+    "  secret(bool): If ``True``, only secret keys will be returned.\n"
+    "  workers(int): the maximum number of concurrent listings.\n"
+    "Returns:\n"
+    "  list[Key]: the matching keys.\n";
+
+static PyObject *
+pygpgme_context_keylist_parallel(PyGpgmeContext *self, PyObject *args,
+                                 PyObject *kwargs)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    static char *kwlist[] = { "patterns", "secret", "workers", NULL };
+    PyObject *py_patterns, *seen = NULL, *result = NULL;
+    char **patterns = NULL;
+    int secret_only = 0, n_workers = 4, n_patterns = 0, i, j;
+    struct keylist_worker *workers = NULL;
+    int *started = NULL;
+    gpgme_error_t err = GPG_ERR_NO_ERROR;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|pi", kwlist,
+                                     &py_patterns, &secret_only, &n_workers))
+        return NULL;
+
+    if (n_workers < 1) {
+        PyErr_SetString(PyExc_ValueError, "workers must be at least 1");
+        return NULL;
+    }
+
+    if (parse_key_patterns(py_patterns, &patterns) < 0)
+        return NULL;
+    if (patterns != NULL) {
+        while (patterns[n_patterns] != NULL)
+            n_patterns++;
+    }
+    if (n_patterns <= 1)
+        n_workers = 1;
+    else if (n_workers > n_patterns)
+        n_workers = n_patterns;
+
+    workers = PyMem_New(struct keylist_worker, n_workers);
+    started = PyMem_New(int, n_workers);
+    if (workers == NULL || started == NULL) {
+        PyErr_NoMemory();
+        goto end;
+    }
+    memset(workers, 0, n_workers * sizeof (struct keylist_worker));
+    memset(started, 0, n_workers * sizeof (int));
+
+    /* deal the patterns out to the workers round robin */
+    for (i = 0; i < n_workers; i++) {
+        struct keylist_worker *worker = &workers[i];
+
+        worker->secret_only = secret_only;
+        if (patterns != NULL) {
+            int n = 0;
+
+            worker->patterns = PyMem_New(const char *,
+                                         n_patterns / n_workers + 2);
+            if (worker->patterns == NULL) {
+                PyErr_NoMemory();
+                goto end;
+            }
+            for (j = i; j < n_patterns; j += n_workers)
+                worker->patterns[n++] = patterns[j];
+            worker->patterns[n] = NULL;
+        }
+        worker->done = PyThread_allocate_lock();
+        if (worker->done == NULL) {
+            PyErr_NoMemory();
+            goto end;
+        }
+        PyThread_acquire_lock(worker->done, WAIT_LOCK);
+    }
+
+    pygpgme_begin_allow_threads(self);
+    for (i = 0; i < n_workers && err == GPG_ERR_NO_ERROR; i++) {
+        err = gpgme_new(&workers[i].ctx);
+        if (err == GPG_ERR_NO_ERROR)
+            err = copy_context_config(workers[i].ctx, self->ctx);
+    }
+    pygpgme_end_allow_threads(self);
+    if (pygpgme_check_error(state, err))
+        goto end;
+
+    Py_BEGIN_ALLOW_THREADS;
+    for (i = 0; i < n_workers; i++) {
+        if (PyThread_start_new_thread(keylist_worker_run, &workers[i]) !=
+            PYTHREAD_INVALID_THREAD_ID)
+            started[i] = 1;
+    }
+    /* run any workers that could not get a thread of their own */
+    for (i = 0; i < n_workers; i++) {
+        if (!started[i])
+            keylist_worker_run(&workers[i]);
+        PyThread_acquire_lock(workers[i].done, WAIT_LOCK);
+    }
+    Py_END_ALLOW_THREADS;
+
+    for (i = 0; i < n_workers; i++) {
+        if (pygpgme_check_error(state, workers[i].err))
+            goto end;
+    }
+
+    /* merge the results, dropping duplicates by fingerprint */
+    seen = PySet_New(NULL);
+    result = PyList_New(0);
+    if (seen == NULL || result == NULL)
+        goto error;
+    for (i = 0; i < n_workers; i++) {
+        for (j = 0; j < (int)workers[i].n_keys; j++) {
+            gpgme_key_t key = workers[i].keys[j];
+            const char *fpr = key->subkeys ? key->subkeys->fpr : NULL;
+            PyObject *item;
+
+            if (fpr != NULL) {
+                PyObject *py_fpr;
+                int found;
+
+                py_fpr = pygpgme_intern_ascii(state, fpr);
+                if (py_fpr == NULL)
+                    goto error;
+                found = PySet_Contains(seen, py_fpr);
+                if (found == 0)
+                    found = PySet_Add(seen, py_fpr);
+                else if (found > 0)
+                    found = 1;
+                Py_DECREF(py_fpr);
+                if (found < 0)
+                    goto error;
+                if (found)
+                    continue;
+            }
+            item = pygpgme_key_new(state, key);
+            if (item == NULL)
+                goto error;
+            if (PyList_Append(result, item) < 0) {
+                Py_DECREF(item);
+                goto error;
+            }
+            Py_DECREF(item);
+        }
+    }
+    goto end;
+
+ error:
+    Py_CLEAR(result);
+ end:
+    Py_XDECREF(seen);
+    if (workers != NULL) {
+        for (i = 0; i < n_workers; i++) {
+            struct keylist_worker *worker = &workers[i];
+            size_t k;
+
+            for (k = 0; k < worker->n_keys; k++)
+                gpgme_key_unref(worker->keys[k]);
+            free(worker->keys);
+            if (worker->ctx != NULL)
+                gpgme_release(worker->ctx);
+            if (worker->done != NULL)
+                PyThread_free_lock(worker->done);
+            PyMem_Free(worker->patterns);
+        }
+        PyMem_Free(workers);
+    }
+    PyMem_Free(started);
+    if (patterns)
+        free_key_patterns(patterns);
+    return result;
+}
+
 // pygpgme_context_trustlist
 
 static PyMethodDef pygpgme_context_methods[] = {
@@ -2051,20 +4208,43 @@ static PyMethodDef pygpgme_context_methods[] = {
       pygpgme_context_set_engine_info_doc },
     { "set_locale", (PyCFunction)pygpgme_context_set_locale, METH_VARARGS,
       pygpgme_context_set_locale_doc },
-    { "get_key", (PyCFunction)pygpgme_context_get_key, METH_VARARGS,
-      pygpgme_context_get_key_doc },
-    { "encrypt", (PyCFunction)pygpgme_context_encrypt, METH_VARARGS,
-      pygpgme_context_encrypt_doc },
-    { "encrypt_sign", (PyCFunction)pygpgme_context_encrypt_sign, METH_VARARGS,
-      pygpgme_context_encrypt_sign_doc },
-    { "decrypt", (PyCFunction)pygpgme_context_decrypt, METH_VARARGS,
-      pygpgme_context_decrypt_doc },
-    { "decrypt_verify", (PyCFunction)pygpgme_context_decrypt_verify, METH_VARARGS,
-      pygpgme_context_decrypt_verify_doc },
-    { "sign", (PyCFunction)pygpgme_context_sign, METH_VARARGS,
-      pygpgme_context_sign_doc },
-    { "verify", (PyCFunction)pygpgme_context_verify, METH_VARARGS,
-      pygpgme_context_verify_doc },
+    { "set_passphrase", (PyCFunction)pygpgme_context_set_passphrase, METH_O,
+      pygpgme_context_set_passphrase_doc },
+    { "set_progress_throttle",
+      (PyCFunction)pygpgme_context_set_progress_throttle,
+      METH_VARARGS | METH_KEYWORDS,
+      pygpgme_context_set_progress_throttle_doc },
+    { "progress_snapshot", (PyCFunction)pygpgme_context_progress_snapshot,
+      METH_NOARGS, pygpgme_context_progress_snapshot_doc },
+    { "set_status_cb", (PyCFunction)pygpgme_context_set_status_cb,
+      METH_VARARGS | METH_KEYWORDS, pygpgme_context_set_status_cb_doc },
+    { "apply_profile", (PyCFunction)pygpgme_context_apply_profile,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_apply_profile_doc },
+    { "clone", (PyCFunction)pygpgme_context_clone, METH_NOARGS,
+      pygpgme_context_clone_doc },
+    { "set_passphrase_keyring",
+      (PyCFunction)pygpgme_context_set_passphrase_keyring, METH_O,
+      pygpgme_context_set_passphrase_keyring_doc },
+    { "get_key", (PyCFunction)pygpgme_context_get_key,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_get_key_doc },
+    { "encrypt", (PyCFunction)pygpgme_context_encrypt,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_encrypt_doc },
+    { "encrypt_sign", (PyCFunction)pygpgme_context_encrypt_sign,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_encrypt_sign_doc },
+    { "decrypt", (PyCFunction)pygpgme_context_decrypt,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_decrypt_doc },
+    { "decrypt_verify", (PyCFunction)pygpgme_context_decrypt_verify,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_decrypt_verify_doc },
+    { "encrypt_symmetric", (PyCFunction)pygpgme_context_encrypt_symmetric,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_encrypt_symmetric_doc },
+    { "decrypt_symmetric", (PyCFunction)pygpgme_context_decrypt_symmetric,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_decrypt_symmetric_doc },
+    { "sign", (PyCFunction)pygpgme_context_sign,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_sign_doc },
+    { "verify", (PyCFunction)pygpgme_context_verify,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_verify_doc },
+    { "verify_ok", (PyCFunction)pygpgme_context_verify_ok,
+      METH_FASTCALL | METH_KEYWORDS, pygpgme_context_verify_ok_doc },
     { "import_", (PyCFunction)pygpgme_context_import, METH_VARARGS,
       pygpgme_context_import_doc },
     { "import_keys", (PyCFunction)pygpgme_context_import_keys, METH_VARARGS,
@@ -2081,8 +4261,15 @@ static PyMethodDef pygpgme_context_methods[] = {
       pygpgme_context_edit_doc },
     { "card_edit", (PyCFunction)pygpgme_context_card_edit, METH_VARARGS,
       pygpgme_context_card_edit_doc },
-    { "keylist", (PyCFunction)pygpgme_context_keylist, METH_VARARGS,
+    { "keylist", (PyCFunction)pygpgme_context_keylist,
+      METH_FASTCALL | METH_KEYWORDS,
       pygpgme_context_keylist_doc },
+    { "keylist_data", (PyCFunction)pygpgme_context_keylist_data, METH_VARARGS,
+      pygpgme_context_keylist_data_doc },
+    { "keylist_parallel", (PyCFunction)pygpgme_context_keylist_parallel,
+      METH_VARARGS | METH_KEYWORDS, pygpgme_context_keylist_parallel_doc },
+    { "keylist_table", (PyCFunction)pygpgme_context_keylist_table,
+      METH_VARARGS | METH_KEYWORDS, pygpgme_context_keylist_table_doc },
     // trustlist
     { NULL, 0, 0 }
 };
@@ -0,0 +1,135 @@
+/* -*- mode: C; c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/*
+    pygpgme - a Python wrapper for the gpgme library
+    Copyright (C) 2006  James Henstridge
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "pygpgme.h"
+#include <structmember.h>
+
+static void
+pygpgme_decrypt_result_dealloc(PyGpgmeDecryptResult *self)
+{
+    Py_XDECREF(self->unsupported_algorithm);
+    Py_XDECREF(self->wrong_key_usage);
+    Py_XDECREF(self->file_name);
+    Py_XDECREF(self->symkey_algo);
+    Py_XDECREF(self->session_key);
+    PyObject_Del(self);
+}
+
+static const char pygpgme_decrypt_result_unsupported_algorithm_doc[] =
+    "Name of the unsupported algorithm that stopped decryption, or ``None``.";
+
+static const char pygpgme_decrypt_result_wrong_key_usage_doc[] =
+    "True if the key was not meant to be used for encryption.";
+
+static const char pygpgme_decrypt_result_file_name_doc[] =
+    "The original file name of the plaintext, if it was stored.";
+
+static const char pygpgme_decrypt_result_symkey_algo_doc[] =
+    "The symmetric cipher and AEAD mode of the message, such as\n"
+    "``\"AES256.OCB\"``, or ``None`` if not known.";
+
+static const char pygpgme_decrypt_result_session_key_doc[] =
+    "The session key of the message, if :attr:`Context.export_session_key`\n"
+    "was set.\n"
+    "\n"
+    "It can be assigned to :attr:`Context.override_session_key` to\n"
+    "decrypt the same message again without the secret key.  Anyone who\n"
+    "has it can read the message, so it must be protected like the\n"
+    "plaintext.";
+
+static PyMemberDef pygpgme_decrypt_result_members[] = {
+    { "unsupported_algorithm", T_OBJECT,
+      offsetof(PyGpgmeDecryptResult, unsupported_algorithm), READONLY,
+      pygpgme_decrypt_result_unsupported_algorithm_doc },
+    { "wrong_key_usage", T_OBJECT,
+      offsetof(PyGpgmeDecryptResult, wrong_key_usage), READONLY,
+      pygpgme_decrypt_result_wrong_key_usage_doc },
+    { "file_name", T_OBJECT, offsetof(PyGpgmeDecryptResult, file_name),
+      READONLY, pygpgme_decrypt_result_file_name_doc },
+    { "symkey_algo", T_OBJECT, offsetof(PyGpgmeDecryptResult, symkey_algo),
+      READONLY, pygpgme_decrypt_result_symkey_algo_doc },
+    { "session_key", T_OBJECT, offsetof(PyGpgmeDecryptResult, session_key),
+      READONLY, pygpgme_decrypt_result_session_key_doc },
+    { NULL, 0, 0, 0 },
+};
+
+static const char pygpgme_decrypt_result_doc[] =
+    "Decryption result.\n"
+    "\n"
+    "Instances of this class are usually obtained as the return value\n"
+    "of :meth:`Context.decrypt`.\n";
+
+static PyType_Slot pygpgme_decrypt_result_slots[] = {
+#if PY_VERSION_HEX < 0x030a0000
+    { Py_tp_init, pygpgme_no_constructor },
+#endif
+    { Py_tp_dealloc, pygpgme_decrypt_result_dealloc },
+    { Py_tp_members, pygpgme_decrypt_result_members },
+    { Py_tp_doc, (void *)pygpgme_decrypt_result_doc },
+    { 0, NULL },
+};
+
+PyType_Spec pygpgme_decrypt_result_spec = {
+    .name = "gpgme.DecryptResult",
+    .basicsize = sizeof(PyGpgmeDecryptResult),
+    .flags = Py_TPFLAGS_DEFAULT
+#if PY_VERSION_HEX >= 0x030a0000
+    | Py_TPFLAGS_DISALLOW_INSTANTIATION | Py_TPFLAGS_IMMUTABLETYPE
+#endif
+    ,
+    .slots = pygpgme_decrypt_result_slots,
+};
+
+static PyObject *
+optional_string(const char *str)
+{
+    if (str == NULL)
+        Py_RETURN_NONE;
+    return PyUnicode_DecodeUTF8(str, strlen(str), "replace");
+}
+
+PyObject *
+pygpgme_decrypt_result(PyGpgmeModState *state, gpgme_ctx_t ctx)
+{
+    gpgme_decrypt_result_t result;
+    PyGpgmeDecryptResult *self;
+
+    result = gpgme_op_decrypt_result(ctx);
+
+    if (result == NULL)
+        Py_RETURN_NONE;
+
+    self = PyObject_New(PyGpgmeDecryptResult, state->DecryptResult_Type);
+    if (!self)
+        return NULL;
+
+    self->unsupported_algorithm = optional_string(result->unsupported_algorithm);
+    self->wrong_key_usage = PyBool_FromLong(result->wrong_key_usage);
+    self->file_name = optional_string(result->file_name);
+    self->symkey_algo = optional_string(result->symkey_algo);
+    self->session_key = optional_string(result->session_key);
+
+    if (!self->unsupported_algorithm || !self->wrong_key_usage ||
+        !self->file_name || !self->symkey_algo || !self->session_key) {
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    return (PyObject *) self;
+}
@@ -72,7 +72,7 @@ pygpgme_engine_info_list_new(PyGpgmeModState *state, gpgme_engine_info_t info)
 	    return NULL;
 	}
 
-	item->protocol = pygpgme_enum_value_new(state->Protocol_Type, info->protocol);
+	item->protocol = pygpgme_enum_value_new(&state->Protocol, info->protocol);
 	if (info->file_name != NULL) {
 	    item->file_name = PyUnicode_FromString(info->file_name);
 	} else {
@@ -102,3 +102,182 @@ pygpgme_engine_info_list_new(PyGpgmeModState *state, gpgme_engine_info_t info)
     }
     return list;
 }
+
+static int
+same_string(const char *a, const char *b)
+{
+    if (a == NULL || b == NULL)
+        return a == b;
+    return strcmp(a, b) == 0;
+}
+
+static PyObject *
+optional_string(const char *str)
+{
+    if (str == NULL)
+        Py_RETURN_NONE;
+    return PyUnicode_FromString(str);
+}
+
+const char pygpgme_engine_info_snapshot_doc[] =
+    "engine_info_snapshot()\n"
+    "--\n\n"
+    "Return the engines gpgme has discovered, as plain data.\n"
+    "\n"
+    "The result can be saved (for instance as JSON) and passed to\n"
+    ":func:`preseed_engine_info` when a later process starts.\n"
+    "\n"
+    "Returns:\n"
+    "  list[tuple[Protocol, str | None, str | None, str | None]]: the\n"
+    "  protocol, file name, home directory and version of each engine.\n";
+
+PyObject *
+pygpgme_engine_info_snapshot(PyObject *mod, PyObject *unused)
+{
+    PyGpgmeModState *state = PyModule_GetState(mod);
+    gpgme_engine_info_t info;
+    gpgme_error_t err;
+    PyObject *list;
+
+    Py_BEGIN_ALLOW_THREADS;
+    err = gpgme_get_engine_info(&info);
+    Py_END_ALLOW_THREADS;
+    if (pygpgme_check_error(state, err))
+        return NULL;
+
+    list = PyList_New(0);
+    if (list == NULL)
+        return NULL;
+    for (; info != NULL; info = info->next) {
+        PyObject *protocol, *item;
+
+        protocol = pygpgme_enum_value_new(&state->Protocol, info->protocol);
+        if (protocol == NULL)
+            goto error;
+        item = Py_BuildValue("(NNNN)", protocol,
+                             optional_string(info->file_name),
+                             optional_string(info->home_dir),
+                             optional_string(info->version));
+        if (item == NULL)
+            goto error;
+        if (PyList_Append(list, item) < 0) {
+            Py_DECREF(item);
+            goto error;
+        }
+        Py_DECREF(item);
+    }
+    return list;
+
+ error:
+    Py_DECREF(list);
+    return NULL;
+}
+
+const char pygpgme_preseed_engine_info_doc[] =
+    "preseed_engine_info(snapshot, /)\n"
+    "--\n\n"
+    "Configure the engines from a saved :func:`engine_info_snapshot`.\n"
+    "\n"
+    "This should be called early, before any :class:`Context` is\n"
+    "created.  Engines whose file name or home directory differ from\n"
+    "gpgme's defaults are set globally.  Contexts created afterwards\n"
+    "copy this configuration, so they do not need\n"
+    ":meth:`Context.set_engine_info`, which starts a process to check\n"
+    "the engine version on every call.\n"
+    "\n"
+    "gpgme searches for gpg and gpgconf when it is initialised, which\n"
+    "happens when :mod:`gpgme` is imported, so this function can not\n"
+    "save that search.\n"
+    "\n"
+    "Args:\n"
+    "  snapshot (Iterable[tuple]): (protocol, file_name, home_dir, ...)\n"
+    "    tuples, as returned by :func:`engine_info_snapshot`.\n"
+    "\n"
+    "Returns:\n"
+    "  int: the number of engines that had to be reconfigured.\n";
+
+PyObject *
+pygpgme_preseed_engine_info(PyObject *mod, PyObject *snapshot)
+{
+    PyGpgmeModState *state = PyModule_GetState(mod);
+    PyObject *items, *seq = NULL, *result = NULL;
+    struct {
+        int protocol;
+        const char *file_name;
+        const char *home_dir;
+    } *entries = NULL;
+    Py_ssize_t i, length;
+    gpgme_engine_info_t info;
+    gpgme_error_t err = 0;
+    int changed = 0;
+
+    /* Copied into tuples, so that the strings used while the GIL is
+     * released can not be freed by another thread.  Lists are
+     * accepted for snapshots that went through JSON. */
+    items = PySequence_Fast(snapshot, "snapshot must be an iterable");
+    if (items == NULL)
+        return NULL;
+    length = PySequence_Fast_GET_SIZE(items);
+    seq = PyTuple_New(length);
+    entries = PyMem_Calloc(length ? length : 1, sizeof(*entries));
+    if (seq == NULL || entries == NULL) {
+        if (seq != NULL)
+            PyErr_NoMemory();
+        goto end;
+    }
+    for (i = 0; i < length; i++) {
+        PyObject *entry;
+
+        entry = PySequence_Tuple(PySequence_Fast_GET_ITEM(items, i));
+        if (entry == NULL)
+            goto end;
+        PyTuple_SET_ITEM(seq, i, entry);
+        if (PyTuple_GET_SIZE(entry) < 3) {
+            PyErr_SetString(PyExc_TypeError,
+                            "snapshot entries must be (protocol, file_name, "
+                            "home_dir, ...) tuples");
+            goto end;
+        }
+        entries[i].protocol = PyLong_AsLong(PyTuple_GET_ITEM(entry, 0));
+        if (entries[i].protocol == -1 && PyErr_Occurred())
+            goto end;
+        if (!PyArg_Parse(PyTuple_GET_ITEM(entry, 1), "z",
+                         &entries[i].file_name) ||
+            !PyArg_Parse(PyTuple_GET_ITEM(entry, 2), "z",
+                         &entries[i].home_dir))
+            goto end;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    err = gpgme_get_engine_info(&info);
+    for (i = 0; !err && i < length; i++) {
+        gpgme_engine_info_t current;
+
+        for (current = info; current != NULL; current = current->next) {
+            if ((int)current->protocol == entries[i].protocol)
+                break;
+        }
+        if (current != NULL &&
+            (entries[i].file_name == NULL ||
+             same_string(current->file_name, entries[i].file_name)) &&
+            same_string(current->home_dir, entries[i].home_dir))
+            continue;
+        err = gpgme_set_engine_info(entries[i].protocol, entries[i].file_name,
+                                    entries[i].home_dir);
+        /* the list is replaced when an engine is changed */
+        if (!err) {
+            changed++;
+            err = gpgme_get_engine_info(&info);
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    if (!pygpgme_check_error(state, err))
+        result = PyLong_FromLong(changed);
+
+ end:
+    Py_DECREF(items);
+    Py_XDECREF(seq);
+    PyMem_Free(entries);
+    return result;
+}
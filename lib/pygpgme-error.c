@@ -19,35 +19,73 @@
  */
 #include "pygpgme.h"
 
+/* Limit on the number of cached error messages.  Only a few hundred
+ * errors can realistically occur, but a bound keeps a stream of
+ * unusual source/code combinations from growing it forever. */
+#define STRERROR_CACHE_SIZE 1024
+
+/* Returns the message for the error, as a new reference. */
+static PyObject *
+error_string(PyGpgmeModState *state, gpgme_error_t err)
+{
+    char buf[256] = { '\0' };
+    PyObject *key, *strerror;
+
+    key = PyLong_FromUnsignedLong(err);
+    if (key == NULL)
+        return NULL;
+    strerror = PyDict_GetItemWithError(state->strerror_cache, key);
+    if (strerror != NULL) {
+        Py_INCREF(strerror);
+        Py_DECREF(key);
+        return strerror;
+    }
+    if (PyErr_Occurred()) {
+        Py_DECREF(key);
+        return NULL;
+    }
+
+    if (gpgme_strerror_r(err, buf, sizeof(buf) - 1) != 0)
+        strcpy(buf, "Unknown");
+    strerror = PyUnicode_DecodeUTF8(buf, strlen(buf), "replace");
+    if (strerror != NULL &&
+        PyDict_GET_SIZE(state->strerror_cache) < STRERROR_CACHE_SIZE &&
+        PyDict_SetItem(state->strerror_cache, key, strerror) < 0)
+        Py_CLEAR(strerror);
+    Py_DECREF(key);
+    return strerror;
+}
+
 PyObject *
 pygpgme_error_object(PyGpgmeModState *state, gpgme_error_t err)
 {
-    char buf[256] = { '\0' };
     PyObject *exc = NULL, *source = NULL, *code = NULL, *strerror = NULL;
+    PyObject *args[3];
 
     if (err == GPG_ERR_NO_ERROR)
         Py_RETURN_NONE;
 
-    if (!(source = pygpgme_enum_value_new(state->ErrSource_Type, gpgme_err_source(err))))
+    if (!(source = pygpgme_enum_value_new(&state->ErrSource, gpgme_err_source(err))))
         goto end;
 
-    if (!(code = pygpgme_enum_value_new(state->ErrCode_Type, gpgme_err_code(err))))
+    if (!(code = pygpgme_enum_value_new(&state->ErrCode, gpgme_err_code(err))))
         goto end;
 
-    /* get the error string */
-    if (gpgme_strerror_r(err, buf, sizeof(buf) - 1) != 0)
-        strcpy(buf, "Unknown");
-    if (!(strerror = PyUnicode_DecodeUTF8(buf, strlen(buf), "replace")))
+    if (!(strerror = error_string(state, err)))
         goto end;
 
-    exc = PyObject_CallFunction(state->pygpgme_error, "OOO", source, code, strerror);
+    args[0] = source;
+    args[1] = code;
+    args[2] = strerror;
+    exc = PyObject_Vectorcall(state->pygpgme_error, args, 3, NULL);
     if (!exc)
         goto end;
 
     /* set the source and code as attributes of the exception object: */
-    PyObject_SetAttrString(exc, "source", source);
-    PyObject_SetAttrString(exc, "code", code);
-    PyObject_SetAttrString(exc, "strerror", strerror);
+    if (PyObject_SetAttr(exc, state->str_source, source) < 0 ||
+        PyObject_SetAttr(exc, state->str_code, code) < 0 ||
+        PyObject_SetAttr(exc, state->str_strerror, strerror) < 0)
+        Py_CLEAR(exc);
 
 end:
     Py_XDECREF(strerror);
@@ -0,0 +1,228 @@
+/* -*- mode: C; c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/*
+    pygpgme - a Python wrapper for the gpgme library
+    Copyright (C) 2006  James Henstridge
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "pygpgme.h"
+
+/* Threads other than the one calling fork() do not exist in the
+ * child, so locks they held at the time can never be released, and
+ * gpgme contexts they were using may be in the middle of talking to
+ * an engine process that belongs to the parent.  Every context and
+ * agent connection is linked into a list in the module state, and
+ * after_fork() walks it in the child to replace those locks and
+ * engine connections.  A hook holding a weak reference to the module
+ * is registered with os.register_at_fork(), so after_fork() runs
+ * automatically when the child is created by os.fork(), without the
+ * registration keeping the module alive. */
+
+#ifdef Py_GIL_DISABLED
+#define FORK_LOCK(state) PyMutex_Lock(&(state)->fork_mutex)
+#define FORK_UNLOCK(state) PyMutex_Unlock(&(state)->fork_mutex)
+#else
+#define FORK_LOCK(state)
+#define FORK_UNLOCK(state)
+#endif
+
+/* Called in the child with a weak reference to the module as self. */
+static PyObject *
+fork_hook(PyObject *ref, PyObject *unused)
+{
+    PyObject *mod, *ret;
+
+#if PY_VERSION_HEX >= 0x030d0000
+    if (PyWeakref_GetRef(ref, &mod) < 0)
+        return NULL;
+#else
+    mod = PyWeakref_GetObject(ref);
+    if (mod == NULL)
+        return NULL;
+    if (mod == Py_None)
+        mod = NULL;
+    Py_XINCREF(mod);
+#endif
+    /* the module has been freed */
+    if (mod == NULL)
+        Py_RETURN_NONE;
+    ret = pygpgme_after_fork(mod, NULL);
+    Py_DECREF(mod);
+    return ret;
+}
+
+static PyMethodDef fork_hook_def = {
+    "after_fork_hook", (PyCFunction)fork_hook, METH_NOARGS, NULL
+};
+
+int
+pygpgme_fork_init(PyGpgmeModState *state, PyObject *mod)
+{
+    PyObject *os, *register_at_fork = NULL, *ref = NULL, *hook = NULL;
+    PyObject *args = NULL, *kwargs = NULL, *ret = NULL;
+
+    state->fork_objects.prev = &state->fork_objects;
+    state->fork_objects.next = &state->fork_objects;
+
+    os = PyImport_ImportModule("os");
+    if (os == NULL)
+        return -1;
+    /* os.register_at_fork() is not available on every platform */
+    if (!PyObject_HasAttrString(os, "register_at_fork")) {
+        Py_DECREF(os);
+        return 0;
+    }
+    register_at_fork = PyObject_GetAttrString(os, "register_at_fork");
+    Py_DECREF(os);
+    if (register_at_fork == NULL)
+        goto end;
+    ref = PyWeakref_NewRef(mod, NULL);
+    if (ref == NULL)
+        goto end;
+    hook = PyCFunction_New(&fork_hook_def, ref);
+    if (hook == NULL)
+        goto end;
+    args = PyTuple_New(0);
+    kwargs = Py_BuildValue("{sO}", "after_in_child", hook);
+    if (args == NULL || kwargs == NULL)
+        goto end;
+    ret = PyObject_Call(register_at_fork, args, kwargs);
+
+ end:
+    Py_XDECREF(register_at_fork);
+    Py_XDECREF(ref);
+    Py_XDECREF(hook);
+    Py_XDECREF(args);
+    Py_XDECREF(kwargs);
+    if (ret == NULL)
+        return -1;
+    Py_DECREF(ret);
+    return 0;
+}
+
+void
+pygpgme_fork_track(PyGpgmeModState *state, PyGpgmeForkLink *link,
+                   PyObject *owner)
+{
+    FORK_LOCK(state);
+    link->owner = owner;
+    link->prev = state->fork_objects.prev;
+    link->next = &state->fork_objects;
+    link->prev->next = link;
+    state->fork_objects.prev = link;
+    FORK_UNLOCK(state);
+}
+
+void
+pygpgme_fork_untrack(PyGpgmeModState *state, PyGpgmeForkLink *link)
+{
+    if (link->next == NULL)
+        return;
+    FORK_LOCK(state);
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    FORK_UNLOCK(state);
+    link->prev = link->next = NULL;
+    link->owner = NULL;
+}
+
+/* Replaces a lock that was held when the process forked.  The
+ * caller must know that the lock was not held by the thread that
+ * forked.  Returns 1 if it was replaced, 0 if it was free, or -1 with
+ * an exception set. */
+int
+pygpgme_fork_reset_lock(PyThread_type_lock *lock)
+{
+    PyThread_type_lock fresh;
+
+    if (*lock == NULL)
+        return 0;
+    if (PyThread_acquire_lock(*lock, NOWAIT_LOCK)) {
+        PyThread_release_lock(*lock);
+        return 0;
+    }
+    fresh = PyThread_allocate_lock();
+    if (fresh == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    /* the old lock is left allocated, since freeing a held lock is
+     * not allowed */
+    *lock = fresh;
+    return 1;
+}
+
+const char pygpgme_after_fork_doc[] =
+    "after_fork()\n"
+    "--\n\n"
+    "Make contexts created before fork() usable in the child.\n"
+    "\n"
+    "Locks held by other threads when the process forked are replaced.\n"
+    "Contexts that were in the middle of an operation, contexts for\n"
+    "protocols other than OpenPGP and agent connections keep their\n"
+    "configuration but get a new gpgme context, so that they do not\n"
+    "share an engine connection with the parent.  The parent's gpgme\n"
+    "contexts are left alone in the child rather than released.  A\n"
+    "context whose callback called :func:`os.fork` is not touched, as\n"
+    "its operation carries on in the child.\n"
+    "\n"
+    "This is called automatically in the child of :func:`os.fork`.  Call\n"
+    "it yourself only if the process was forked without going through\n"
+    "Python, before using any context in the child.  Key iterators\n"
+    "started before the fork must not be used in the child.\n";
+
+PyObject *
+pygpgme_after_fork(PyObject *mod, PyObject *unused)
+{
+    PyGpgmeModState *state = PyModule_GetState(mod);
+    PyObject *type = NULL, *value = NULL, *traceback = NULL;
+    PyGpgmeForkLink *link;
+    int failed = 0;
+
+    /* the module may already have been cleared at shutdown */
+    if (state->Context_Type == NULL)
+        Py_RETURN_NONE;
+#ifdef Py_GIL_DISABLED
+    /* other threads may have held these when the process forked */
+    state->fork_mutex = (PyMutex){0};
+    state->intern_mutex = (PyMutex){0};
+#endif
+    pygpgme_enums_after_fork(state);
+    /* Nothing else is running, so the list is walked without locking.
+     * Every object is fixed up as far as possible, and the first
+     * error is reported. */
+    for (link = state->fork_objects.next; link != &state->fork_objects;
+         link = link->next) {
+        int ret;
+
+        if (PyObject_TypeCheck(link->owner, state->Context_Type))
+            ret = pygpgme_context_after_fork((PyGpgmeContext *)link->owner);
+        else
+            ret = pygpgme_agent_connection_after_fork(
+                (PyGpgmeAgentConnection *)link->owner);
+        if (ret < 0) {
+            if (!failed)
+                PyErr_Fetch(&type, &value, &traceback);
+            else
+                PyErr_Clear();
+            failed = 1;
+        }
+    }
+    if (failed) {
+        PyErr_Restore(type, value, traceback);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
@@ -37,6 +37,7 @@ pygpgme_import_result_dealloc(PyGpgmeImportResult *self)
     Py_XDECREF(self->secret_unchanged);
     Py_XDECREF(self->skipped_new_keys);
     Py_XDECREF(self->not_imported);
+    PyMem_Free(self->statuses);
     Py_XDECREF(self->imports);
     PyObject_Del(self);
 }
@@ -62,16 +63,55 @@ static PyMemberDef pygpgme_import_result_members[] = {
       offsetof(PyGpgmeImportResult, skipped_new_keys), READONLY},
     { "not_imported", T_OBJECT,
       offsetof(PyGpgmeImportResult, not_imported), READONLY},
-    { "imports", T_OBJECT, offsetof(PyGpgmeImportResult, imports), READONLY},
     { NULL, 0, 0, 0}
 };
 
+static PyObject *
+make_imports(PyObject *obj)
+{
+    PyGpgmeImportResult *self = (PyGpgmeImportResult *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
+    PyObject *list;
+    Py_ssize_t i;
+
+    list = PyList_New(self->n_statuses);
+    if (!list)
+        return NULL;
+    for (i = 0; i < self->n_statuses; i++) {
+        struct pygpgme_import_status *status = &self->statuses[i];
+        PyObject *item;
+
+        item = Py_BuildValue("(NNN)",
+                             pygpgme_intern_ascii(state, status->fpr),
+                             pygpgme_error_object(state, status->result),
+                             pygpgme_enum_value_new(&state->Import, status->status));
+        if (!item) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        PyList_SET_ITEM(list, i, item);
+    }
+    return list;
+}
+
+static PyObject *
+pygpgme_import_result_get_imports(PyGpgmeImportResult *self, void *closure)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->imports, make_imports);
+}
+
+static PyGetSetDef pygpgme_import_result_getsets[] = {
+    { "imports", (getter)pygpgme_import_result_get_imports, NULL, NULL },
+    { NULL, (getter)0, (setter)0 }
+};
+
 static PyType_Slot pygpgme_import_result_slots[] = {
 #if PY_VERSION_HEX < 0x030a0000
     { Py_tp_init, pygpgme_no_constructor },
 #endif
     { Py_tp_dealloc, pygpgme_import_result_dealloc },
     { Py_tp_members, pygpgme_import_result_members },
+    { Py_tp_getset, pygpgme_import_result_getsets },
     { 0, NULL },
 };
 
@@ -92,6 +132,9 @@ pygpgme_import_result(PyGpgmeModState *state, gpgme_ctx_t ctx)
     gpgme_import_result_t result;
     gpgme_import_status_t status;
     PyGpgmeImportResult *self;
+    Py_ssize_t i;
+    size_t size;
+    char *strings;
 
     result = gpgme_op_import_result(ctx);
 
@@ -101,6 +144,10 @@ pygpgme_import_result(PyGpgmeModState *state, gpgme_ctx_t ctx)
     self = PyObject_New(PyGpgmeImportResult, state->ImportResult_Type);
     if (!self)
         return NULL;
+    /* set before anything can fail, as dealloc frees them */
+    self->statuses = NULL;
+    self->n_statuses = 0;
+    self->imports = NULL;
 
 #define ADD_INT(name) \
     self->name = PyLong_FromLong(result->name)
@@ -120,29 +167,39 @@ pygpgme_import_result(PyGpgmeModState *state, gpgme_ctx_t ctx)
     ADD_INT(skipped_new_keys);
     ADD_INT(not_imported);
 
-    self->imports = PyList_New(0);
-    if (!self->imports)
-        return NULL;
+    /* Keep a copy of the per-key statuses, which are only turned into
+     * Python objects if the imports attribute is used. */
+    size = 0;
     for (status = result->imports; status != NULL; status = status->next) {
-        PyObject *py_fpr, *item;
-
+        self->n_statuses++;
         if (status->fpr)
-            py_fpr = PyUnicode_DecodeASCII(status->fpr, strlen(status->fpr),
-                                           "replace");
-        else {
-            py_fpr = Py_None;
-            Py_INCREF(py_fpr);
-        }
-        item = Py_BuildValue("(NNN)",
-                             py_fpr,
-                             pygpgme_error_object(state, status->result),
-                             pygpgme_enum_value_new(state->Import_Type, status->status));
-        if (!item) {
-            Py_DECREF(self);
-            return NULL;
+            size += strlen(status->fpr) + 1;
+    }
+    if (PyErr_Occurred()) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    if (self->n_statuses == 0)
+        return (PyObject *)self;
+
+    self->statuses = PyMem_Malloc(
+        self->n_statuses * sizeof(struct pygpgme_import_status) + size);
+    if (!self->statuses) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    strings = (char *)(self->statuses + self->n_statuses);
+    for (status = result->imports, i = 0; status != NULL;
+         status = status->next, i++) {
+        self->statuses[i].fpr = NULL;
+        if (status->fpr) {
+            size = strlen(status->fpr) + 1;
+            memcpy(strings, status->fpr, size);
+            self->statuses[i].fpr = strings;
+            strings += size;
         }
-        PyList_Append(self->imports, item);
-        Py_DECREF(item);
+        self->statuses[i].result = status->result;
+        self->statuses[i].status = status->status;
     }
 
     return (PyObject *)self;
@@ -0,0 +1,109 @@
+/* -*- mode: C; c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/*
+    pygpgme - a Python wrapper for the gpgme library
+    Copyright (C) 2006  James Henstridge
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "pygpgme.h"
+
+/* Fingerprints and key IDs are decoded to str over and over: every
+ * listing of a key, every verification by it.  Strings decoded
+ * through pygpgme_intern_ascii() are remembered in a direct mapped
+ * table, so the same fingerprint usually comes back as the same str
+ * object.  A new string simply replaces whatever was in its slot, so
+ * the table never holds more than INTERN_TABLE_SIZE strings. */
+#define INTERN_TABLE_SIZE 4096
+#define INTERN_MAX_LENGTH 64
+
+#ifdef Py_GIL_DISABLED
+#define INTERN_LOCK(state) PyMutex_Lock(&(state)->intern_mutex)
+#define INTERN_UNLOCK(state) PyMutex_Unlock(&(state)->intern_mutex)
+#else
+#define INTERN_LOCK(state)
+#define INTERN_UNLOCK(state)
+#endif
+
+int
+pygpgme_intern_init(PyGpgmeModState *state)
+{
+    state->intern_table = PyMem_Calloc(INTERN_TABLE_SIZE, sizeof(PyObject *));
+    if (state->intern_table == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+void
+pygpgme_intern_clear(PyGpgmeModState *state)
+{
+    PyObject **table = state->intern_table;
+    int i;
+
+    if (table == NULL)
+        return;
+    state->intern_table = NULL;
+    for (i = 0; i < INTERN_TABLE_SIZE; i++)
+        Py_XDECREF(table[i]);
+    PyMem_Free(table);
+}
+
+/* Returns str for a NUL terminated ASCII string such as a fingerprint
+ * or key ID, or None if str is NULL. */
+PyObject *
+pygpgme_intern_ascii(PyGpgmeModState *state, const char *str)
+{
+    const unsigned char *p;
+    Py_uhash_t hash = 2166136261U;
+    PyObject **slot, *value, *old;
+    Py_ssize_t length;
+
+    if (str == NULL)
+        Py_RETURN_NONE;
+
+    /* FNV-1a, checking that the string is short and plain ASCII */
+    for (p = (const unsigned char *)str; *p != '\0'; p++) {
+        if (*p >= 0x80 || p - (const unsigned char *)str >= INTERN_MAX_LENGTH)
+            return PyUnicode_DecodeASCII(str, strlen(str), "replace");
+        hash = (hash ^ *p) * 16777619U;
+    }
+    length = p - (const unsigned char *)str;
+    if (state->intern_table == NULL)
+        return PyUnicode_DecodeASCII(str, length, "strict");
+
+    slot = &state->intern_table[hash & (INTERN_TABLE_SIZE - 1)];
+    INTERN_LOCK(state);
+    value = *slot;
+    if (value != NULL && PyUnicode_GET_LENGTH(value) == length &&
+        memcmp(PyUnicode_1BYTE_DATA(value), str, length) == 0) {
+        Py_INCREF(value);
+        INTERN_UNLOCK(state);
+        return value;
+    }
+    INTERN_UNLOCK(state);
+
+    value = PyUnicode_DecodeASCII(str, length, "strict");
+    if (value == NULL)
+        return NULL;
+
+    Py_INCREF(value);
+    INTERN_LOCK(state);
+    old = *slot;
+    *slot = value;
+    INTERN_UNLOCK(state);
+    Py_XDECREF(old);
+    return value;
+}
@@ -23,10 +23,12 @@
 static void
 pygpgme_subkey_dealloc(PyGpgmeSubkey *self)
 {
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
     self->subkey = NULL;
-    Py_XDECREF(self->parent);
-    self->parent = NULL;
-    PyObject_Del(self);
+    gpgme_key_unref(self->key);
+    self->key = NULL;
+    pygpgme_free_list_release(&state->Subkey_free, (PyObject *)self);
 }
 
 static PyObject *
@@ -88,7 +90,7 @@ pygpgme_subkey_get_pubkey_algo(PyGpgmeSubkey *self)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
 
-    return pygpgme_enum_value_new(state->PubkeyAlgo_Type, self->subkey->pubkey_algo);
+    return pygpgme_enum_value_new(&state->PubkeyAlgo, self->subkey->pubkey_algo);
 }
 
 static PyObject *
@@ -100,21 +102,25 @@ pygpgme_subkey_get_length(PyGpgmeSubkey *self)
 static PyObject *
 pygpgme_subkey_get_keyid(PyGpgmeSubkey *self)
 {
-    if (self->subkey->keyid)
-        return PyUnicode_DecodeASCII(self->subkey->keyid,
-                                     strlen(self->subkey->keyid), "replace");
-    else
-        Py_RETURN_NONE;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_intern_ascii(state, self->subkey->keyid);
 }
 
 static PyObject *
 pygpgme_subkey_get_fpr(PyGpgmeSubkey *self)
 {
-    if (self->subkey->fpr)
-        return PyUnicode_DecodeASCII(self->subkey->fpr,
-                                     strlen(self->subkey->fpr), "replace");
-    else
-        Py_RETURN_NONE;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_intern_ascii(state, self->subkey->fpr);
+}
+
+static PyObject *
+pygpgme_subkey_get_keygrip(PyGpgmeSubkey *self)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_intern_ascii(state, self->subkey->keygrip);
 }
 
 static PyObject *
@@ -143,6 +149,7 @@ static PyGetSetDef pygpgme_subkey_getsets[] = {
     { "length", (getter)pygpgme_subkey_get_length },
     { "keyid", (getter)pygpgme_subkey_get_keyid },
     { "fpr", (getter)pygpgme_subkey_get_fpr },
+    { "keygrip", (getter)pygpgme_subkey_get_keygrip },
     { "timestamp", (getter)pygpgme_subkey_get_timestamp },
     { "expires", (getter)pygpgme_subkey_get_expires },
     { NULL, (getter)0, (setter)0 }
@@ -171,10 +178,12 @@ PyType_Spec pygpgme_subkey_spec = {
 static void
 pygpgme_key_sig_dealloc(PyGpgmeKeySig *self)
 {
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
     self->key_sig = NULL;
-    Py_XDECREF(self->parent);
-    self->parent = NULL;
-    PyObject_Del(self);
+    gpgme_key_unref(self->key);
+    self->key = NULL;
+    pygpgme_free_list_release(&state->KeySig_free, (PyObject *)self);
 }
 
 static PyObject *
@@ -206,17 +215,15 @@ pygpgme_key_sig_get_pubkey_algo(PyGpgmeKeySig *self)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
 
-    return pygpgme_enum_value_new(state->PubkeyAlgo_Type, self->key_sig->pubkey_algo);
+    return pygpgme_enum_value_new(&state->PubkeyAlgo, self->key_sig->pubkey_algo);
 }
 
 static PyObject *
 pygpgme_key_sig_get_keyid(PyGpgmeKeySig *self)
 {
-    if (self->key_sig->keyid)
-        return PyUnicode_DecodeASCII(self->key_sig->keyid,
-                                     strlen(self->key_sig->keyid), "replace");
-    else
-        Py_RETURN_NONE;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_intern_ascii(state, self->key_sig->keyid);
 }
 
 static PyObject *
@@ -326,10 +333,13 @@ PyType_Spec pygpgme_key_sig_spec = {
 static void
 pygpgme_user_id_dealloc(PyGpgmeUserId *self)
 {
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
     self->user_id = NULL;
-    Py_XDECREF(self->parent);
-    self->parent = NULL;
-    PyObject_Del(self);
+    gpgme_key_unref(self->key);
+    self->key = NULL;
+    Py_XDECREF(self->signatures);
+    pygpgme_free_list_release(&state->UserId_free, (PyObject *)self);
 }
 
 static PyObject *
@@ -349,7 +359,7 @@ pygpgme_user_id_get_validity(PyGpgmeUserId *self)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
 
-    return pygpgme_enum_value_new(state->Validity_Type, self->user_id->validity);
+    return pygpgme_enum_value_new(&state->Validity, self->user_id->validity);
 }
 
 static PyObject *
@@ -393,32 +403,44 @@ pygpgme_user_id_get_comment(PyGpgmeUserId *self)
 }
 
 static PyObject *
-pygpgme_user_id_get_signatures(PyGpgmeUserId *self)
+make_signatures(PyObject *obj)
 {
-    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    PyGpgmeUserId *self = (PyGpgmeUserId *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
     PyObject *ret;
     gpgme_key_sig_t sig;
+    Py_ssize_t i, length = 0;
 
-    ret = PyList_New(0);
+    for (sig = self->user_id->signatures; sig != NULL; sig = sig->next)
+        length++;
+    ret = PyTuple_New(length);
     if (ret == NULL)
         return NULL;
-    for (sig = self->user_id->signatures; sig != NULL; sig = sig->next) {
+    for (sig = self->user_id->signatures, i = 0; sig != NULL;
+         sig = sig->next, i++) {
         PyGpgmeKeySig *item;
 
-        item = PyObject_New(PyGpgmeKeySig, state->KeySig_Type);
+        item = (PyGpgmeKeySig *)pygpgme_free_list_alloc(
+            &state->KeySig_free, state->KeySig_Type);
         if (item == NULL) {
             Py_DECREF(ret);
             return NULL;
         }
         item->key_sig = sig;
-        Py_INCREF(self);
-        item->parent = (PyObject *)self;
-        PyList_Append(ret, (PyObject *)item);
-        Py_DECREF(item);
+        gpgme_key_ref(self->key);
+        item->key = self->key;
+        PyTuple_SET_ITEM(ret, i, (PyObject *)item);
     }
     return ret;
 }
 
+static PyObject *
+pygpgme_user_id_get_signatures(PyGpgmeUserId *self)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->signatures,
+                              make_signatures);
+}
+
 static PyGetSetDef pygpgme_user_id_getsets[] = {
     { "revoked", (getter)pygpgme_user_id_get_revoked },
     { "invalid", (getter)pygpgme_user_id_get_invalid },
@@ -456,9 +478,80 @@ pygpgme_key_dealloc(PyGpgmeKey *self)
 {
     gpgme_key_unref(self->key);
     self->key = NULL;
+    Py_XDECREF(self->subkeys);
+    Py_XDECREF(self->uids);
     PyObject_Del(self);
 }
 
+/* Returns the fingerprint of the primary key, or NULL if unknown. */
+static const char *
+key_fpr(gpgme_key_t key)
+{
+    if (key->fpr != NULL)
+        return key->fpr;
+    if (key->subkeys != NULL)
+        return key->subkeys->fpr;
+    return NULL;
+}
+
+static Py_hash_t
+pygpgme_key_hash(PyGpgmeKey *self)
+{
+    const unsigned char *fpr = (const unsigned char *)key_fpr(self->key);
+    Py_uhash_t hash;
+
+    if (self->hash != -1)
+        return self->hash;
+
+    if (fpr != NULL) {
+        /* FNV-1a over the fingerprint */
+        hash = 14695981039346656037ULL & (Py_uhash_t)-1;
+        for (; *fpr != '\0'; fpr++) {
+            hash ^= *fpr;
+            hash *= 1099511628211ULL & (Py_uhash_t)-1;
+        }
+    } else {
+        /* without a fingerprint, keys are only equal to themselves */
+        hash = (Py_uhash_t)(uintptr_t)self >> 4;
+    }
+    if ((Py_hash_t)hash == -1)
+        hash = (Py_uhash_t)-2;
+    self->hash = (Py_hash_t)hash;
+    return self->hash;
+}
+
+static PyObject *
+pygpgme_key_richcompare(PyGpgmeKey *self, PyObject *other, int op)
+{
+    const char *fpr, *other_fpr;
+    int equal;
+
+    if (!Py_IS_TYPE(other, Py_TYPE(self)) || (op != Py_EQ && op != Py_NE))
+        Py_RETURN_NOTIMPLEMENTED;
+
+    fpr = key_fpr(self->key);
+    other_fpr = key_fpr(((PyGpgmeKey *)other)->key);
+    if (fpr != NULL && other_fpr != NULL)
+        equal = strcmp(fpr, other_fpr) == 0;
+    else
+        equal = (PyObject *)self == other;
+
+    return PyBool_FromLong(op == Py_EQ ? equal : !equal);
+}
+
+static const char pygpgme_key_fpr_doc[] =
+    "The fingerprint of the primary key, or ``None`` if unknown.\n"
+    "\n"
+    "Keys compare equal and hash alike if they have the same fingerprint.\n";
+
+static PyObject *
+pygpgme_key_get_fpr(PyGpgmeKey *self)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_intern_ascii(state, key_fpr(self->key));
+}
+
 static const char pygpgme_key_revoked_doc[] =
     "True if the key has been revoked.";
 
@@ -558,7 +651,7 @@ pygpgme_key_get_protocol(PyGpgmeKey *self)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
 
-    return pygpgme_enum_value_new(state->Protocol_Type, self->key->protocol);
+    return pygpgme_enum_value_new(&state->Protocol, self->key->protocol);
 }
 
 static const char pygpgme_key_issuer_serial_doc[] =
@@ -616,73 +709,95 @@ pygpgme_key_get_owner_trust(PyGpgmeKey *self)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
 
-    return pygpgme_enum_value_new(state->Validity_Type, self->key->owner_trust);
+    return pygpgme_enum_value_new(&state->Validity, self->key->owner_trust);
 }
 
 static const char pygpgme_key_subkeys_doc[] =
-    "List of the key's subkeys as instances of :class:`Subkey`.\n"
+    "Tuple of the key's subkeys as instances of :class:`Subkey`.\n"
     "\n"
     "The first subkey in the list is the primary key and usually available.\n";
 
 static PyObject *
-pygpgme_key_get_subkeys(PyGpgmeKey *self)
+make_subkeys(PyObject *obj)
 {
-    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    PyGpgmeKey *self = (PyGpgmeKey *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
     PyObject *ret;
     gpgme_subkey_t subkey;
+    Py_ssize_t i, length = 0;
 
-    ret = PyList_New(0);
+    for (subkey = self->key->subkeys; subkey != NULL; subkey = subkey->next)
+        length++;
+    ret = PyTuple_New(length);
     if (ret == NULL)
         return NULL;
-    for (subkey = self->key->subkeys; subkey != NULL; subkey = subkey->next) {
+    for (subkey = self->key->subkeys, i = 0; subkey != NULL;
+         subkey = subkey->next, i++) {
         PyGpgmeSubkey *item;
 
-        item = PyObject_New(PyGpgmeSubkey, state->Subkey_Type);
+        item = (PyGpgmeSubkey *)pygpgme_free_list_alloc(
+            &state->Subkey_free, state->Subkey_Type);
         if (item == NULL) {
             Py_DECREF(ret);
             return NULL;
         }
         item->subkey = subkey;
-        Py_INCREF(self);
-        item->parent = (PyObject *)self;
-        PyList_Append(ret, (PyObject *)item);
-        Py_DECREF(item);
+        gpgme_key_ref(self->key);
+        item->key = self->key;
+        PyTuple_SET_ITEM(ret, i, (PyObject *)item);
     }
     return ret;
 }
 
+static PyObject *
+pygpgme_key_get_subkeys(PyGpgmeKey *self)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->subkeys, make_subkeys);
+}
+
 static const char pygpgme_key_uids_doc[] =
-    "List of the key's user IDs as instances of :class:`UserId`.\n"
+    "Tuple of the key's user IDs as instances of :class:`UserId`.\n"
     "\n"
     "The first user ID in the list is the main (or primary) user ID.\n";
 
 static PyObject *
-pygpgme_key_get_uids(PyGpgmeKey *self)
+make_uids(PyObject *obj)
 {
-    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+    PyGpgmeKey *self = (PyGpgmeKey *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
     PyObject *ret;
     gpgme_user_id_t uid;
+    Py_ssize_t i, length = 0;
 
-    ret = PyList_New(0);
+    for (uid = self->key->uids; uid != NULL; uid = uid->next)
+        length++;
+    ret = PyTuple_New(length);
     if (ret == NULL)
         return NULL;
-    for (uid = self->key->uids; uid != NULL; uid = uid->next) {
+    for (uid = self->key->uids, i = 0; uid != NULL; uid = uid->next, i++) {
         PyGpgmeUserId *item;
 
-        item = PyObject_New(PyGpgmeUserId, state->UserId_Type);
+        item = (PyGpgmeUserId *)pygpgme_free_list_alloc(
+            &state->UserId_free, state->UserId_Type);
         if (item == NULL) {
             Py_DECREF(ret);
             return NULL;
         }
         item->user_id = uid;
-        Py_INCREF(self);
-        item->parent = (PyObject *)self;
-        PyList_Append(ret, (PyObject *)item);
-        Py_DECREF(item);
+        gpgme_key_ref(self->key);
+        item->key = self->key;
+        item->signatures = NULL;
+        PyTuple_SET_ITEM(ret, i, (PyObject *)item);
     }
     return ret;
 }
 
+static PyObject *
+pygpgme_key_get_uids(PyGpgmeKey *self)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->uids, make_uids);
+}
+
 static const char pygpgme_key_keylist_mode_doc[] =
     "The keylist mode that was active when the key was retrieved.\n"
     "\n"
@@ -693,10 +808,12 @@ pygpgme_key_get_keylist_mode(PyGpgmeKey *self)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
 
-    return pygpgme_enum_value_new(state->KeylistMode_Type, self->key->keylist_mode);
+    return pygpgme_enum_value_new(&state->KeylistMode, self->key->keylist_mode);
 }
 
 static PyGetSetDef pygpgme_key_getsets[] = {
+    { "fpr", (getter)pygpgme_key_get_fpr, NULL,
+      pygpgme_key_fpr_doc },
     { "revoked", (getter)pygpgme_key_get_revoked, NULL,
       pygpgme_key_revoked_doc },
     { "expired", (getter)pygpgme_key_get_expired, NULL,
@@ -739,6 +856,8 @@ static PyType_Slot pygpgme_key_slots[] = {
     { Py_tp_init, pygpgme_no_constructor },
 #endif
     { Py_tp_dealloc, pygpgme_key_dealloc },
+    { Py_tp_hash, pygpgme_key_hash },
+    { Py_tp_richcompare, pygpgme_key_richcompare },
     { Py_tp_getset, pygpgme_key_getsets },
     { 0, NULL },
 };
@@ -765,5 +884,8 @@ pygpgme_key_new(PyGpgmeModState *state, gpgme_key_t key)
 
     gpgme_key_ref(key);
     self->key = key;
+    self->hash = -1;
+    self->subkeys = NULL;
+    self->uids = NULL;
     return (PyObject *)self;
 }
@@ -18,6 +18,79 @@
     Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 #include "pygpgme.h"
+#include <strings.h>
+
+/* Returns true if one of the key's user IDs has an email address in
+ * the given domain. */
+static int
+key_has_uid_domain(gpgme_key_t key, const char *domain)
+{
+    gpgme_user_id_t uid;
+
+    for (uid = key->uids; uid != NULL; uid = uid->next) {
+        const char *at;
+
+        if (uid->email == NULL)
+            continue;
+        at = strrchr(uid->email, '@');
+        if (at != NULL && strcasecmp(at + 1, domain) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+/* Checks a key against the filter.  This does not touch any Python
+ * objects, so may be called without holding the GIL. */
+int
+pygpgme_key_filter_match(const PyGpgmeKeyFilter *filter, gpgme_key_t key)
+{
+    gpgme_subkey_t primary = key->subkeys;
+
+    if (!filter->active)
+        return 1;
+
+    if (filter->can_encrypt && !key->can_encrypt)
+        return 0;
+    if (filter->can_sign && !key->can_sign)
+        return 0;
+    if (filter->exclude_expired && key->expired)
+        return 0;
+    if (filter->exclude_revoked && key->revoked)
+        return 0;
+    if (filter->exclude_disabled && key->disabled)
+        return 0;
+
+    if (filter->pubkey_algo >= 0 || filter->min_length > 0 ||
+        filter->max_length > 0 || filter->expires_before > 0 ||
+        filter->expires_after > 0) {
+        if (primary == NULL)
+            return 0;
+        if (filter->pubkey_algo >= 0 &&
+            primary->pubkey_algo != (gpgme_pubkey_algo_t)filter->pubkey_algo)
+            return 0;
+        if (filter->min_length > 0 &&
+            primary->length < (unsigned int)filter->min_length)
+            return 0;
+        if (filter->max_length > 0 &&
+            primary->length > (unsigned int)filter->max_length)
+            return 0;
+        /* an expiry time of 0 means the key does not expire */
+        if (filter->expires_before > 0 &&
+            (primary->expires == 0 ||
+             primary->expires >= filter->expires_before))
+            return 0;
+        if (filter->expires_after > 0 &&
+            primary->expires != 0 &&
+            primary->expires <= filter->expires_after)
+            return 0;
+    }
+
+    if (filter->uid_domain != NULL &&
+        !key_has_uid_domain(key, filter->uid_domain))
+        return 0;
+
+    return 1;
+}
 
 static void
 pygpgme_keyiter_dealloc(PyGpgmeKeyIter *self)
@@ -32,9 +105,16 @@ pygpgme_keyiter_dealloc(PyGpgmeKeyIter *self)
             PyErr_WriteUnraisable(exc);
         }
         Py_XDECREF(exc);
+        /* the data's release callback needs the context */
+        if (self->data) {
+            gpgme_data_release(self->data);
+            self->data = NULL;
+        }
         Py_DECREF(self->ctx);
         self->ctx = NULL;
     }
+    free(self->filter.uid_domain);
+    self->filter.uid_domain = NULL;
     PyObject_Del(self);
 }
 
@@ -53,9 +133,19 @@ pygpgme_keyiter_next(PyGpgmeKeyIter *self)
     gpgme_error_t err;
     PyObject *ret;
 
-    Py_BEGIN_ALLOW_THREADS;
-    err = gpgme_op_keylist_next(self->ctx->ctx, &key);
-    Py_END_ALLOW_THREADS;
+    /* Skip keys rejected by the filter without creating Key objects.
+     * The context's thread state is saved so that data callbacks used
+     * by keylist_data() can run. */
+    pygpgme_begin_allow_threads(self->ctx);
+    for (;;) {
+        err = gpgme_op_keylist_next(self->ctx->ctx, &key);
+        if (err != GPG_ERR_NO_ERROR || key == NULL ||
+            pygpgme_key_filter_match(&self->filter, key))
+            break;
+        gpgme_key_unref(key);
+        key = NULL;
+    }
+    pygpgme_end_allow_threads(self->ctx);
 
     /* end iteration */
     if (gpgme_err_source(err) == GPG_ERR_SOURCE_GPGME &&
@@ -0,0 +1,291 @@
+/* -*- mode: C; c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/*
+    pygpgme - a Python wrapper for the gpgme library
+    Copyright (C) 2006  James Henstridge
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "pygpgme.h"
+
+/* Columns available from Context.keylist_table().  String columns
+ * have no format and are returned as lists; the others are packed
+ * into a buffer and returned as a memoryview with the given format. */
+typedef enum {
+    COLUMN_FPR,
+    COLUMN_KEYID,
+    COLUMN_UID,
+    COLUMN_TIMESTAMP,
+    COLUMN_EXPIRES,
+    COLUMN_PUBKEY_ALGO,
+    COLUMN_LENGTH,
+    COLUMN_VALIDITY,
+    COLUMN_OWNER_TRUST,
+    COLUMN_FLAGS,
+    N_COLUMNS
+} column_id;
+
+static const struct {
+    const char *name;
+    const char *format;
+} columns[N_COLUMNS] = {
+    [COLUMN_FPR] = { "fpr", NULL },
+    [COLUMN_KEYID] = { "keyid", NULL },
+    [COLUMN_UID] = { "uid", NULL },
+    [COLUMN_TIMESTAMP] = { "timestamp", "q" },
+    [COLUMN_EXPIRES] = { "expires", "q" },
+    [COLUMN_PUBKEY_ALGO] = { "pubkey_algo", "i" },
+    [COLUMN_LENGTH] = { "length", "I" },
+    [COLUMN_VALIDITY] = { "validity", "i" },
+    [COLUMN_OWNER_TRUST] = { "owner_trust", "i" },
+    [COLUMN_FLAGS] = { "flags", "I" },
+};
+
+static unsigned int
+key_flags(gpgme_key_t key)
+{
+    unsigned int flags = 0;
+
+    if (key->revoked)
+        flags |= PYGPGME_KEY_FLAG_REVOKED;
+    if (key->expired)
+        flags |= PYGPGME_KEY_FLAG_EXPIRED;
+    if (key->disabled)
+        flags |= PYGPGME_KEY_FLAG_DISABLED;
+    if (key->invalid)
+        flags |= PYGPGME_KEY_FLAG_INVALID;
+    if (key->can_encrypt)
+        flags |= PYGPGME_KEY_FLAG_CAN_ENCRYPT;
+    if (key->can_sign)
+        flags |= PYGPGME_KEY_FLAG_CAN_SIGN;
+    if (key->can_certify)
+        flags |= PYGPGME_KEY_FLAG_CAN_CERTIFY;
+    if (key->can_authenticate)
+        flags |= PYGPGME_KEY_FLAG_CAN_AUTHENTICATE;
+    if (key->secret)
+        flags |= PYGPGME_KEY_FLAG_SECRET;
+    return flags;
+}
+
+static PyObject *
+make_string_column(PyGpgmeModState *state, column_id column,
+                   gpgme_key_t *keys, Py_ssize_t n_keys)
+{
+    PyObject *list;
+    Py_ssize_t i;
+
+    list = PyList_New(n_keys);
+    if (list == NULL)
+        return NULL;
+    for (i = 0; i < n_keys; i++) {
+        gpgme_key_t key = keys[i];
+        PyObject *item;
+
+        switch (column) {
+        case COLUMN_FPR:
+            item = pygpgme_intern_ascii(
+                state, key->subkeys ? key->subkeys->fpr : NULL);
+            break;
+        case COLUMN_KEYID:
+            item = pygpgme_intern_ascii(
+                state, key->subkeys ? key->subkeys->keyid : NULL);
+            break;
+        case COLUMN_UID:
+            if (key->uids != NULL && key->uids->uid != NULL) {
+                item = PyUnicode_DecodeUTF8(key->uids->uid,
+                                            strlen(key->uids->uid), "replace");
+            } else {
+                Py_INCREF(Py_None);
+                item = Py_None;
+            }
+            break;
+        default:
+            item = NULL;
+            PyErr_SetString(PyExc_SystemError, "not a string column");
+            break;
+        }
+        if (item == NULL) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        PyList_SET_ITEM(list, i, item);
+    }
+    return list;
+}
+
+static PyObject *
+make_numeric_column(column_id column, gpgme_key_t *keys, Py_ssize_t n_keys)
+{
+    PyObject *buffer, *view, *ret;
+    Py_ssize_t i;
+    size_t itemsize;
+    char *data;
+
+    switch (column) {
+    case COLUMN_TIMESTAMP:
+    case COLUMN_EXPIRES:
+        itemsize = sizeof(long long);
+        break;
+    case COLUMN_PUBKEY_ALGO:
+    case COLUMN_VALIDITY:
+    case COLUMN_OWNER_TRUST:
+        itemsize = sizeof(int);
+        break;
+    default:
+        itemsize = sizeof(unsigned int);
+        break;
+    }
+
+    buffer = PyBytes_FromStringAndSize(NULL, n_keys * itemsize);
+    if (buffer == NULL)
+        return NULL;
+    data = PyBytes_AS_STRING(buffer);
+
+    for (i = 0; i < n_keys; i++) {
+        gpgme_key_t key = keys[i];
+        gpgme_subkey_t primary = key->subkeys;
+        void *item = data + i * itemsize;
+
+        switch (column) {
+        case COLUMN_TIMESTAMP:
+            *(long long *)item = primary ? primary->timestamp : 0;
+            break;
+        case COLUMN_EXPIRES:
+            *(long long *)item = primary ? primary->expires : 0;
+            break;
+        case COLUMN_PUBKEY_ALGO:
+            *(int *)item = primary ? (int)primary->pubkey_algo : 0;
+            break;
+        case COLUMN_LENGTH:
+            *(unsigned int *)item = primary ? primary->length : 0;
+            break;
+        case COLUMN_VALIDITY:
+            *(int *)item = key->uids ? (int)key->uids->validity
+                : GPGME_VALIDITY_UNKNOWN;
+            break;
+        case COLUMN_OWNER_TRUST:
+            *(int *)item = key->owner_trust;
+            break;
+        case COLUMN_FLAGS:
+            *(unsigned int *)item = key_flags(key);
+            break;
+        default:
+            break;
+        }
+    }
+
+    view = PyMemoryView_FromObject(buffer);
+    Py_DECREF(buffer);
+    if (view == NULL)
+        return NULL;
+    ret = PyObject_CallMethod(view, "cast", "s", columns[column].format);
+    Py_DECREF(view);
+    return ret;
+}
+
+static int
+lookup_column(PyObject *name)
+{
+    int i;
+
+    if (!PyUnicode_Check(name)) {
+        PyErr_SetString(PyExc_TypeError, "field names must be strings");
+        return -1;
+    }
+    for (i = 0; i < N_COLUMNS; i++) {
+        if (PyUnicode_CompareWithASCIIString(name, columns[i].name) == 0)
+            return i;
+    }
+    PyErr_Format(PyExc_ValueError, "unknown keylist field %R", name);
+    return -1;
+}
+
+/* Returns a tuple of the requested field names after checking they
+ * are all known.  If fields is None, all fields are requested. */
+PyObject *
+pygpgme_key_table_fields(PyObject *fields)
+{
+    PyObject *seq, *ret;
+    Py_ssize_t i, length;
+
+    if (fields == Py_None) {
+        ret = PyTuple_New(N_COLUMNS);
+        if (ret == NULL)
+            return NULL;
+        for (i = 0; i < N_COLUMNS; i++) {
+            PyObject *name = PyUnicode_FromString(columns[i].name);
+
+            if (name == NULL) {
+                Py_DECREF(ret);
+                return NULL;
+            }
+            PyTuple_SET_ITEM(ret, i, name);
+        }
+        return ret;
+    }
+
+    seq = PySequence_Fast(fields, "fields must be a sequence of strings");
+    if (seq == NULL)
+        return NULL;
+    length = PySequence_Fast_GET_SIZE(seq);
+    for (i = 0; i < length; i++) {
+        if (lookup_column(PySequence_Fast_GET_ITEM(seq, i)) < 0) {
+            Py_DECREF(seq);
+            return NULL;
+        }
+    }
+    ret = PySequence_Tuple(seq);
+    Py_DECREF(seq);
+    return ret;
+}
+
+/* Builds a dictionary mapping each field name to a column holding
+ * that field for every key. */
+PyObject *
+pygpgme_key_table_new(PyGpgmeModState *state, gpgme_key_t *keys,
+                      Py_ssize_t n_keys, PyObject *fields)
+{
+    PyObject *table;
+    Py_ssize_t i;
+
+    table = PyDict_New();
+    if (table == NULL)
+        return NULL;
+
+    for (i = 0; i < PyTuple_GET_SIZE(fields); i++) {
+        PyObject *name = PyTuple_GET_ITEM(fields, i);
+        PyObject *column;
+        int id;
+
+        id = lookup_column(name);
+        if (id < 0)
+            goto error;
+        if (columns[id].format == NULL)
+            column = make_string_column(state, id, keys, n_keys);
+        else
+            column = make_numeric_column(id, keys, n_keys);
+        if (column == NULL)
+            goto error;
+        if (PyDict_SetItem(table, name, column) < 0) {
+            Py_DECREF(column);
+            goto error;
+        }
+        Py_DECREF(column);
+    }
+    return table;
+
+ error:
+    Py_DECREF(table);
+    return NULL;
+}
@@ -0,0 +1,520 @@
+/* -*- mode: C; c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/*
+    pygpgme - a Python wrapper for the gpgme library
+    Copyright (C) 2006  James Henstridge
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "pygpgme.h"
+#include <ctype.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_request_key) && defined(SYS_keyctl)
+#define HAVE_KEYRING 1
+#ifndef KEYCTL_READ
+#define KEYCTL_READ 11
+#endif
+#endif
+#endif
+
+/* Passphrase providers answer gpgme's passphrase requests without
+ * calling into Python.  The callback runs with the GIL released, so
+ * it must only touch the provider, which is owned by the context and
+ * only replaced while holding the context's lock. */
+
+typedef enum {
+    PROVIDER_STATIC,
+    PROVIDER_MAP,
+    PROVIDER_KEYRING,
+} provider_kind;
+
+struct passphrase_entry {
+    char *key;                  /* key ID or user ID */
+    char *secret;
+    size_t secret_len;
+};
+
+struct _PyGpgmePassphraseProvider {
+    provider_kind kind;
+    char *secret;               /* PROVIDER_STATIC */
+    size_t secret_len;
+    struct passphrase_entry *entries; /* PROVIDER_MAP */
+    Py_ssize_t n_entries;
+    char *prefix;               /* PROVIDER_KEYRING */
+};
+
+/* Overwrites a secret before its memory is released.  The volatile
+ * pointer stops the compiler from dropping the stores. */
+void
+pygpgme_wipe(void *buffer, size_t length)
+{
+    volatile char *p = buffer;
+
+    while (length--)
+        *p++ = '\0';
+}
+
+static void
+free_secret(char *secret, size_t length)
+{
+    if (secret == NULL)
+        return;
+    pygpgme_wipe(secret, length);
+    PyMem_Free(secret);
+}
+
+void
+pygpgme_passphrase_provider_free(PyGpgmePassphraseProvider *provider)
+{
+    Py_ssize_t i;
+
+    if (provider == NULL)
+        return;
+    free_secret(provider->secret, provider->secret_len);
+    for (i = 0; i < provider->n_entries; i++) {
+        PyMem_Free(provider->entries[i].key);
+        free_secret(provider->entries[i].secret,
+                    provider->entries[i].secret_len);
+    }
+    PyMem_Free(provider->entries);
+    PyMem_Free(provider->prefix);
+    PyMem_Free(provider);
+}
+
+static char *
+copy_string(const char *str, size_t length)
+{
+    char *copy = PyMem_Malloc(length + 1);
+
+    if (copy == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    memcpy(copy, str, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+/* Copies a passphrase given as str or bytes. */
+static int
+copy_secret(PyObject *value, char **secret, size_t *secret_len)
+{
+    const char *str;
+    Py_ssize_t length;
+
+    if (PyUnicode_Check(value)) {
+        str = PyUnicode_AsUTF8AndSize(value, &length);
+        if (str == NULL)
+            return -1;
+    } else if (PyBytes_Check(value)) {
+        str = PyBytes_AS_STRING(value);
+        length = PyBytes_GET_SIZE(value);
+    } else {
+        PyErr_SetString(PyExc_TypeError, "passphrase must be str or bytes");
+        return -1;
+    }
+    if (memchr(str, '\n', length) != NULL) {
+        PyErr_SetString(PyExc_ValueError,
+                        "passphrase must not contain a newline");
+        return -1;
+    }
+    *secret = copy_string(str, length);
+    if (*secret == NULL)
+        return -1;
+    *secret_len = length;
+    return 0;
+}
+
+static int
+is_hex(const char *str, size_t length)
+{
+    size_t i;
+
+    for (i = 0; i < length; i++) {
+        if (!isxdigit((unsigned char)str[i]))
+            return 0;
+    }
+    return 1;
+}
+
+/* Converts a key given as a key ID or fingerprint into the 16 digit
+ * upper case key ID used in gpg's passphrase requests.  Anything else
+ * is taken to be a user ID and copied unchanged.  Short key IDs are
+ * rejected, as the requests do not say which keys they could match. */
+static char *
+normalise_key(PyObject *key)
+{
+    const char *str;
+    Py_ssize_t length;
+    int prefixed = 0;
+    char *copy;
+    Py_ssize_t i;
+
+    if (!PyUnicode_Check(key)) {
+        PyErr_SetString(PyExc_TypeError, "passphrase keys must be strings");
+        return NULL;
+    }
+    str = PyUnicode_AsUTF8AndSize(key, &length);
+    if (str == NULL)
+        return NULL;
+    if (length > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X') &&
+        is_hex(str + 2, length - 2)) {
+        str += 2;
+        length -= 2;
+        prefixed = 1;
+    }
+    if (!is_hex(str, length) ||
+        (!prefixed && length != 8 && length != 16 && length != 40 &&
+         length != 64))
+        return copy_string(str, length);
+
+    if (length == 40)           /* v4 fingerprint: key ID is the tail */
+        str += 24;
+    if (length == 40 || length == 64)
+        length = 16;
+    if (length != 16) {
+        PyErr_Format(PyExc_ValueError,
+                     "%R is not a 16 digit key ID or a fingerprint", key);
+        return NULL;
+    }
+    copy = copy_string(str, length);
+    if (copy == NULL)
+        return NULL;
+    for (i = 0; i < length; i++)
+        copy[i] = toupper((unsigned char)copy[i]);
+    return copy;
+}
+
+PyGpgmePassphraseProvider *
+pygpgme_passphrase_provider_new(PyObject *passphrase)
+{
+    PyGpgmePassphraseProvider *provider;
+    PyObject *items = NULL;
+    Py_ssize_t i, length;
+
+    provider = PyMem_Calloc(1, sizeof(PyGpgmePassphraseProvider));
+    if (provider == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    if (PyUnicode_Check(passphrase) || PyBytes_Check(passphrase)) {
+        provider->kind = PROVIDER_STATIC;
+        if (copy_secret(passphrase, &provider->secret,
+                        &provider->secret_len) < 0)
+            goto error;
+        return provider;
+    }
+
+    if (!PyMapping_Check(passphrase)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "passphrase must be str, bytes or a mapping");
+        goto error;
+    }
+    provider->kind = PROVIDER_MAP;
+    items = PyMapping_Items(passphrase);
+    if (items == NULL)
+        goto error;
+    length = PyList_GET_SIZE(items);
+    provider->entries = PyMem_Calloc(length ? length : 1,
+                                     sizeof(struct passphrase_entry));
+    if (provider->entries == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    for (i = 0; i < length; i++) {
+        PyObject *item = PyList_GET_ITEM(items, i);
+        struct passphrase_entry *entry = &provider->entries[i];
+
+        if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
+            PyErr_SetString(PyExc_TypeError,
+                            "mapping items must be (key, value) pairs");
+            goto error;
+        }
+        provider->n_entries++;
+        entry->key = normalise_key(PyTuple_GET_ITEM(item, 0));
+        if (entry->key == NULL)
+            goto error;
+        if (copy_secret(PyTuple_GET_ITEM(item, 1), &entry->secret,
+                        &entry->secret_len) < 0)
+            goto error;
+    }
+    Py_DECREF(items);
+    return provider;
+
+ error:
+    Py_XDECREF(items);
+    pygpgme_passphrase_provider_free(provider);
+    return NULL;
+}
+
+PyGpgmePassphraseProvider *
+pygpgme_passphrase_keyring_new(PyObject *prefix)
+{
+#ifdef HAVE_KEYRING
+    PyGpgmePassphraseProvider *provider;
+    const char *str;
+    Py_ssize_t length;
+
+    if (!PyUnicode_Check(prefix)) {
+        PyErr_SetString(PyExc_TypeError, "prefix must be a string");
+        return NULL;
+    }
+    str = PyUnicode_AsUTF8AndSize(prefix, &length);
+    if (str == NULL)
+        return NULL;
+
+    provider = PyMem_Calloc(1, sizeof(PyGpgmePassphraseProvider));
+    if (provider == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    provider->kind = PROVIDER_KEYRING;
+    provider->prefix = copy_string(str, length);
+    if (provider->prefix == NULL) {
+        pygpgme_passphrase_provider_free(provider);
+        return NULL;
+    }
+    return provider;
+#else
+    PyErr_SetString(PyExc_NotImplementedError,
+                    "the kernel keyring is only available on Linux");
+    return NULL;
+#endif
+}
+
+/* Returns a deep copy of a provider, or NULL with an exception set. */
+PyGpgmePassphraseProvider *
+pygpgme_passphrase_provider_copy(const PyGpgmePassphraseProvider *provider)
+{
+    PyGpgmePassphraseProvider *copy;
+    Py_ssize_t i;
+
+    copy = PyMem_Calloc(1, sizeof(PyGpgmePassphraseProvider));
+    if (copy == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    copy->kind = provider->kind;
+    if (provider->secret != NULL) {
+        copy->secret = copy_string(provider->secret, provider->secret_len);
+        if (copy->secret == NULL)
+            goto error;
+        copy->secret_len = provider->secret_len;
+    }
+    if (provider->prefix != NULL) {
+        copy->prefix = copy_string(provider->prefix,
+                                   strlen(provider->prefix));
+        if (copy->prefix == NULL)
+            goto error;
+    }
+    if (provider->n_entries > 0) {
+        copy->entries = PyMem_Calloc(provider->n_entries,
+                                     sizeof(struct passphrase_entry));
+        if (copy->entries == NULL) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        for (i = 0; i < provider->n_entries; i++) {
+            const struct passphrase_entry *entry = &provider->entries[i];
+
+            copy->n_entries++;
+            copy->entries[i].key = copy_string(entry->key,
+                                               strlen(entry->key));
+            if (copy->entries[i].key == NULL)
+                goto error;
+            copy->entries[i].secret = copy_string(entry->secret,
+                                                  entry->secret_len);
+            if (copy->entries[i].secret == NULL)
+                goto error;
+            copy->entries[i].secret_len = entry->secret_len;
+        }
+    }
+    return copy;
+
+ error:
+    pygpgme_passphrase_provider_free(copy);
+    return NULL;
+}
+
+/* Returns the length of the first space separated token in str. */
+static size_t
+token_length(const char *str)
+{
+    const char *end = strchr(str, ' ');
+
+    return end ? (size_t)(end - str) : strlen(str);
+}
+
+/* Returns true if str starts with a 16 digit key ID token. */
+static int
+is_keyid_token(const char *str)
+{
+    return str != NULL && token_length(str) == 16 && is_hex(str, 16);
+}
+
+static int
+token_equal(const char *token, size_t length, const char *key)
+{
+    return strlen(key) == length && memcmp(token, key, length) == 0;
+}
+
+/* The uid hint is "KEYID USERID", and the passphrase info for a key
+ * is "MAINKEYID KEYID PUBKEY_ALGO 0". */
+static struct passphrase_entry *
+find_entry(PyGpgmePassphraseProvider *provider, const char *uid_hint,
+           const char *passphrase_info)
+{
+    const char *user_id = NULL, *main_keyid = NULL, *keyid = NULL;
+    Py_ssize_t i;
+
+    if (is_keyid_token(uid_hint)) {
+        keyid = uid_hint;
+        if (uid_hint[16] == ' ')
+            user_id = uid_hint + 17;
+    }
+    if (is_keyid_token(passphrase_info)) {
+        main_keyid = passphrase_info;
+        if (passphrase_info[16] == ' ' && is_keyid_token(passphrase_info + 17))
+            keyid = passphrase_info + 17;
+    }
+
+    for (i = 0; i < provider->n_entries; i++) {
+        struct passphrase_entry *entry = &provider->entries[i];
+
+        if ((main_keyid && token_equal(main_keyid, 16, entry->key)) ||
+            (keyid && token_equal(keyid, 16, entry->key)) ||
+            (user_id && strcmp(user_id, entry->key) == 0))
+            return entry;
+    }
+    return NULL;
+}
+
+#ifdef HAVE_KEYRING
+/* Reads the passphrase from the "user" key named by the prefix and the
+ * primary key ID.  The returned buffer must be wiped and released with
+ * PyMem_RawFree(). */
+static gpgme_error_t
+read_keyring(PyGpgmePassphraseProvider *provider, const char *uid_hint,
+             const char *passphrase_info, char **secret, size_t *secret_len)
+{
+    const char *keyid;
+    char *description, *buffer, *newline;
+    size_t prefix_len = strlen(provider->prefix);
+    long serial, length, size = 64;
+
+    if (is_keyid_token(passphrase_info))
+        keyid = passphrase_info;
+    else if (is_keyid_token(uid_hint))
+        keyid = uid_hint;
+    else
+        return gpgme_error(GPG_ERR_NO_PASSPHRASE);
+
+    description = PyMem_RawMalloc(prefix_len + 17);
+    if (description == NULL)
+        return gpgme_error(GPG_ERR_ENOMEM);
+    memcpy(description, provider->prefix, prefix_len);
+    memcpy(description + prefix_len, keyid, 16);
+    description[prefix_len + 16] = '\0';
+    serial = syscall(SYS_request_key, "user", description, NULL, 0);
+    PyMem_RawFree(description);
+    if (serial < 0) {
+        if (errno == ENOKEY || errno == EKEYEXPIRED || errno == EKEYREVOKED)
+            return gpgme_error(GPG_ERR_NO_PASSPHRASE);
+        return gpgme_error_from_errno(errno);
+    }
+
+    /* the payload may grow between calls, so retry until it fits */
+    for (;;) {
+        buffer = PyMem_RawMalloc(size);
+        if (buffer == NULL)
+            return gpgme_error(GPG_ERR_ENOMEM);
+        length = syscall(SYS_keyctl, KEYCTL_READ, serial, buffer, size);
+        if (length < 0) {
+            gpgme_error_t err = gpgme_error_from_errno(errno);
+
+            PyMem_RawFree(buffer);
+            return err;
+        }
+        if (length <= size)
+            break;
+        pygpgme_wipe(buffer, size);
+        PyMem_RawFree(buffer);
+        size = length;
+    }
+
+    /* only the first line is used */
+    newline = memchr(buffer, '\n', length);
+    *secret_len = newline ? (size_t)(newline - buffer) : (size_t)length;
+    pygpgme_wipe(buffer + *secret_len, length - *secret_len);
+    *secret = buffer;
+    return GPG_ERR_NO_ERROR;
+}
+#endif
+
+gpgme_error_t
+pygpgme_passphrase_provider_cb(void *hook, const char *uid_hint,
+                               const char *passphrase_info,
+                               int prev_was_bad, int fd)
+{
+    PyGpgmePassphraseProvider *provider = hook;
+    struct passphrase_entry *entry;
+    const char *secret = NULL;
+    char *buffer = NULL;
+    size_t length = 0;
+    gpgme_error_t err = GPG_ERR_NO_ERROR;
+
+    /* asking again would only give the same answer */
+    if (prev_was_bad)
+        return gpgme_error(GPG_ERR_BAD_PASSPHRASE);
+
+    switch (provider->kind) {
+    case PROVIDER_STATIC:
+        secret = provider->secret;
+        length = provider->secret_len;
+        break;
+    case PROVIDER_MAP:
+        entry = find_entry(provider, uid_hint, passphrase_info);
+        if (entry == NULL)
+            return gpgme_error(GPG_ERR_NO_PASSPHRASE);
+        secret = entry->secret;
+        length = entry->secret_len;
+        break;
+    case PROVIDER_KEYRING:
+#ifdef HAVE_KEYRING
+        err = read_keyring(provider, uid_hint, passphrase_info,
+                           &buffer, &length);
+        if (err)
+            return err;
+        secret = buffer;
+#else
+        return gpgme_error(GPG_ERR_NOT_IMPLEMENTED);
+#endif
+        break;
+    }
+
+    if (gpgme_io_writen(fd, secret, length) < 0 ||
+        gpgme_io_writen(fd, "\n", 1) < 0)
+        err = gpgme_error_from_errno(errno);
+
+    if (buffer != NULL) {
+        pygpgme_wipe(buffer, length);
+        PyMem_RawFree(buffer);
+    }
+    return err;
+}
@@ -0,0 +1,172 @@
+/* -*- mode: C; c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/*
+    pygpgme - a Python wrapper for the gpgme library
+    Copyright (C) 2006  James Henstridge
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "pygpgme.h"
+
+/* Returns true if the key has a subkey that may be used to encrypt. */
+static int
+key_can_encrypt(gpgme_key_t key)
+{
+    gpgme_subkey_t subkey;
+
+    if (key->revoked || key->expired || key->disabled || key->invalid)
+        return 0;
+
+    for (subkey = key->subkeys; subkey != NULL; subkey = subkey->next) {
+        if (subkey->can_encrypt && !subkey->revoked && !subkey->expired &&
+            !subkey->disabled && !subkey->invalid)
+            return 1;
+    }
+    return 0;
+}
+
+static void
+pygpgme_recipient_set_dealloc(PyGpgmeRecipientSet *self)
+{
+    Py_ssize_t i;
+
+    if (self->keys) {
+        for (i = 0; i < self->length; i++)
+            gpgme_key_unref(self->keys[i]);
+        PyMem_Free(self->keys);
+    }
+    self->keys = NULL;
+    PyObject_Del(self);
+}
+
+static PyObject *
+pygpgme_recipient_set_new(PyTypeObject *type, PyObject *args,
+                          PyObject *kwargs)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(type);
+    static char *kwlist[] = { "keys", NULL };
+    PyGpgmeRecipientSet *self = NULL;
+    PyObject *py_keys, *seq = NULL;
+    Py_ssize_t i, length;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", kwlist, &py_keys))
+        return NULL;
+
+    seq = PySequence_Fast(py_keys, "keys must be a sequence");
+    if (seq == NULL)
+        return NULL;
+
+    length = PySequence_Fast_GET_SIZE(seq);
+    if (length == 0) {
+        PyErr_SetString(PyExc_ValueError, "keys must not be empty");
+        goto error;
+    }
+
+    self = (PyGpgmeRecipientSet *)type->tp_alloc(type, 0);
+    if (self == NULL)
+        goto error;
+
+    self->keys = PyMem_New(gpgme_key_t, length + 1);
+    if (self->keys == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    self->length = 0;
+    self->keys[0] = NULL;
+
+    for (i = 0; i < length; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(seq, i);
+        gpgme_key_t key;
+
+        if (!Py_IS_TYPE(item, state->Key_Type)) {
+            PyErr_SetString(PyExc_TypeError,
+                            "items in keys must be gpgme.Key objects");
+            goto error;
+        }
+        key = ((PyGpgmeKey *)item)->key;
+        if (!key_can_encrypt(key)) {
+            const char *fpr = key->subkeys ? key->subkeys->fpr : NULL;
+
+            PyErr_Format(PyExc_ValueError,
+                         "key %s can not be used for encryption",
+                         fpr ? fpr : "(unknown)");
+            goto error;
+        }
+        gpgme_key_ref(key);
+        self->keys[self->length++] = key;
+        self->keys[self->length] = NULL;
+    }
+
+    Py_DECREF(seq);
+    return (PyObject *)self;
+
+ error:
+    Py_XDECREF(self);
+    Py_DECREF(seq);
+    return NULL;
+}
+
+static Py_ssize_t
+pygpgme_recipient_set_length(PyGpgmeRecipientSet *self)
+{
+    return self->length;
+}
+
+static PyObject *
+pygpgme_recipient_set_item(PyGpgmeRecipientSet *self, Py_ssize_t i)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    if (i < 0 || i >= self->length) {
+        PyErr_SetString(PyExc_IndexError, "index out of range");
+        return NULL;
+    }
+    return pygpgme_key_new(state, self->keys[i]);
+}
+
+static const char pygpgme_recipient_set_doc[] =
+    "RecipientSet(keys)\n"
+    "--\n\n"
+    "An immutable, pre-validated set of encryption recipients.\n"
+    "\n"
+    "Every key is checked once on construction: it must not be revoked,\n"
+    "expired, disabled or invalid, and must have a subkey capable of\n"
+    "encryption.  A :exc:`ValueError` is raised otherwise.\n"
+    "\n"
+    "The set can be passed as the recipients argument of\n"
+    ":meth:`Context.encrypt` and :meth:`Context.encrypt_sign`, avoiding\n"
+    "the cost of converting a list of keys on every call.\n"
+    "\n"
+    "Args:\n"
+    "  keys(list[Key]): the recipient keys.\n";
+
+static PyType_Slot pygpgme_recipient_set_slots[] = {
+    { Py_tp_dealloc, pygpgme_recipient_set_dealloc },
+    { Py_tp_new, pygpgme_recipient_set_new },
+    { Py_sq_length, pygpgme_recipient_set_length },
+    { Py_sq_item, pygpgme_recipient_set_item },
+    { Py_tp_doc, (void *)pygpgme_recipient_set_doc },
+    { 0, NULL },
+};
+
+PyType_Spec pygpgme_recipient_set_spec = {
+    .name = "gpgme.RecipientSet",
+    .basicsize = sizeof(PyGpgmeRecipientSet),
+    .flags = Py_TPFLAGS_DEFAULT
+#if PY_VERSION_HEX >= 0x030a0000
+    | Py_TPFLAGS_IMMUTABLETYPE
+#endif
+    ,
+    .slots = pygpgme_recipient_set_slots,
+};
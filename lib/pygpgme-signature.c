@@ -24,13 +24,15 @@
 static void
 pygpgme_newsig_dealloc(PyGpgmeNewSignature *self)
 {
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
     Py_XDECREF(self->type);
     Py_XDECREF(self->pubkey_algo);
     Py_XDECREF(self->hash_algo);
     Py_XDECREF(self->timestamp);
     Py_XDECREF(self->fpr);
     Py_XDECREF(self->sig_class);
-    PyObject_Del(self);
+    pygpgme_free_list_release(&state->NewSignature_free, (PyObject *)self);
 }
 
 static PyMemberDef pygpgme_newsig_members[] = {
@@ -78,23 +80,18 @@ pygpgme_newsiglist_new(PyGpgmeModState *state, gpgme_new_signature_t siglist)
 
     list = PyList_New(0);
     for (sig = siglist; sig != NULL; sig = sig->next) {
-        PyGpgmeNewSignature *item = PyObject_New(PyGpgmeNewSignature,
-                                                 state->NewSignature_Type);
+        PyGpgmeNewSignature *item = (PyGpgmeNewSignature *)
+            pygpgme_free_list_alloc(&state->NewSignature_free,
+                                    state->NewSignature_Type);
         if (item == NULL) {
             Py_DECREF(list);
             return NULL;
         }
-        item->type = pygpgme_enum_value_new(state->SigMode_Type, sig->type);
-        item->pubkey_algo = pygpgme_enum_value_new(state->PubkeyAlgo_Type, sig->pubkey_algo);
-        item->hash_algo = pygpgme_enum_value_new(state->HashAlgo_Type, sig->hash_algo);
+        item->type = pygpgme_enum_value_new(&state->SigMode, sig->type);
+        item->pubkey_algo = pygpgme_enum_value_new(&state->PubkeyAlgo, sig->pubkey_algo);
+        item->hash_algo = pygpgme_enum_value_new(&state->HashAlgo, sig->hash_algo);
         item->timestamp = PyLong_FromLong(sig->timestamp);
-        if (sig->fpr) {
-            item->fpr = PyUnicode_DecodeASCII(sig->fpr, strlen(sig->fpr),
-                                              "replace");
-        } else {
-            Py_INCREF(Py_None);
-            item->fpr = Py_None;
-        }
+        item->fpr = pygpgme_intern_ascii(state, sig->fpr);
         item->sig_class = PyLong_FromLong(sig->sig_class);
         if (PyErr_Occurred()) {
             Py_DECREF(item);
@@ -110,18 +107,127 @@ pygpgme_newsiglist_new(PyGpgmeModState *state, gpgme_new_signature_t siglist)
 static void
 pygpgme_sig_dealloc(PyGpgmeSignature *self)
 {
-    Py_XDECREF(self->summary);
-    Py_XDECREF(self->fpr);
-    Py_XDECREF(self->status);
-    Py_XDECREF(self->notations);
-    Py_XDECREF(self->timestamp);
-    Py_XDECREF(self->exp_timestamp);
-    Py_XDECREF(self->wrong_key_usage);
-    Py_XDECREF(self->validity);
-    Py_XDECREF(self->validity_reason);
-    Py_XDECREF(self->pubkey_algo);
-    Py_XDECREF(self->hash_algo);
-    PyObject_Del(self);
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    PyMem_Free(self->fpr);
+    PyMem_Free(self->notations);
+    Py_XDECREF(self->fpr_obj);
+    Py_XDECREF(self->status_obj);
+    Py_XDECREF(self->notations_obj);
+    Py_XDECREF(self->validity_reason_obj);
+    pygpgme_free_list_release(&state->Signature_free, (PyObject *)self);
+}
+
+static PyObject *
+make_fpr(PyObject *obj)
+{
+    PyGpgmeSignature *self = (PyGpgmeSignature *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
+
+    return pygpgme_intern_ascii(state, self->fpr);
+}
+
+static PyObject *
+make_status(PyObject *obj)
+{
+    PyGpgmeSignature *self = (PyGpgmeSignature *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
+
+    return pygpgme_error_object(state, self->status);
+}
+
+static PyObject *
+make_notations(PyObject *obj)
+{
+    PyGpgmeSignature *self = (PyGpgmeSignature *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
+
+    return pygpgme_sig_notation_list_new(state, self->notations);
+}
+
+static PyObject *
+make_validity_reason(PyObject *obj)
+{
+    PyGpgmeSignature *self = (PyGpgmeSignature *)obj;
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(obj));
+
+    return pygpgme_error_object(state, self->validity_reason);
+}
+
+static PyObject *
+pygpgme_sig_get_summary(PyGpgmeSignature *self, void *closure)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_enum_value_new(&state->Sigsum, self->summary);
+}
+
+static PyObject *
+pygpgme_sig_get_fpr(PyGpgmeSignature *self, void *closure)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->fpr_obj, make_fpr);
+}
+
+static PyObject *
+pygpgme_sig_get_status(PyGpgmeSignature *self, void *closure)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->status_obj, make_status);
+}
+
+static PyObject *
+pygpgme_sig_get_notations(PyGpgmeSignature *self, void *closure)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->notations_obj,
+                              make_notations);
+}
+
+static PyObject *
+pygpgme_sig_get_timestamp(PyGpgmeSignature *self, void *closure)
+{
+    return PyLong_FromLong(self->timestamp);
+}
+
+static PyObject *
+pygpgme_sig_get_exp_timestamp(PyGpgmeSignature *self, void *closure)
+{
+    return PyLong_FromLong(self->exp_timestamp);
+}
+
+static PyObject *
+pygpgme_sig_get_wrong_key_usage(PyGpgmeSignature *self, void *closure)
+{
+    return PyBool_FromLong(self->wrong_key_usage);
+}
+
+static PyObject *
+pygpgme_sig_get_validity(PyGpgmeSignature *self, void *closure)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_enum_value_new(&state->Validity, self->validity);
+}
+
+static PyObject *
+pygpgme_sig_get_validity_reason(PyGpgmeSignature *self, void *closure)
+{
+    return pygpgme_get_cached((PyObject *)self, &self->validity_reason_obj,
+                              make_validity_reason);
+}
+
+static PyObject *
+pygpgme_sig_get_pubkey_algo(PyGpgmeSignature *self, void *closure)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_enum_value_new(&state->PubkeyAlgo, self->pubkey_algo);
+}
+
+static PyObject *
+pygpgme_sig_get_hash_algo(PyGpgmeSignature *self, void *closure)
+{
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
+    return pygpgme_enum_value_new(&state->HashAlgo, self->hash_algo);
 }
 
 static const char pygpgme_sig_summary_doc[] =
@@ -166,33 +272,30 @@ static const char pygpgme_sig_pubkey_algo_doc[] =
 static const char pygpgme_sig_hash_algo_doc[] =
     "The hash algorithm of the signature, as a :class:`HashAlgo` constant.";
 
-static PyMemberDef pygpgme_sig_members[] = {
-    { "summary", T_OBJECT, offsetof(PyGpgmeSignature, summary), READONLY,
+static PyGetSetDef pygpgme_sig_getsets[] = {
+    { "summary", (getter)pygpgme_sig_get_summary, NULL,
       pygpgme_sig_summary_doc },
-    { "fpr", T_OBJECT, offsetof(PyGpgmeSignature, fpr), READONLY,
+    { "fpr", (getter)pygpgme_sig_get_fpr, NULL,
       pygpgme_sig_fpr_doc },
-    { "status", T_OBJECT, offsetof(PyGpgmeSignature, status), READONLY,
+    { "status", (getter)pygpgme_sig_get_status, NULL,
       pygpgme_sig_status_doc },
-    { "notations", T_OBJECT, offsetof(PyGpgmeSignature, notations), READONLY,
+    { "notations", (getter)pygpgme_sig_get_notations, NULL,
       pygpgme_sig_notations_doc },
-    { "timestamp", T_OBJECT, offsetof(PyGpgmeSignature, timestamp), READONLY,
+    { "timestamp", (getter)pygpgme_sig_get_timestamp, NULL,
       pygpgme_sig_timestamp_doc },
-    { "exp_timestamp", T_OBJECT,
-      offsetof(PyGpgmeSignature, exp_timestamp), READONLY,
+    { "exp_timestamp", (getter)pygpgme_sig_get_exp_timestamp, NULL,
       pygpgme_sig_exp_timestamp_doc },
-    { "wrong_key_usage", T_OBJECT,
-      offsetof(PyGpgmeSignature, wrong_key_usage), READONLY,
+    { "wrong_key_usage", (getter)pygpgme_sig_get_wrong_key_usage, NULL,
       pygpgme_sig_wrong_key_usage_doc },
-    { "validity", T_OBJECT, offsetof(PyGpgmeSignature, validity), READONLY,
+    { "validity", (getter)pygpgme_sig_get_validity, NULL,
       pygpgme_sig_validity_doc },
-    { "validity_reason", T_OBJECT,
-      offsetof(PyGpgmeSignature, validity_reason), READONLY,
+    { "validity_reason", (getter)pygpgme_sig_get_validity_reason, NULL,
       pygpgme_sig_validity_reason_doc },
-    { "pubkey_algo", T_OBJECT, offsetof(PyGpgmeSignature, pubkey_algo), READONLY,
+    { "pubkey_algo", (getter)pygpgme_sig_get_pubkey_algo, NULL,
       pygpgme_sig_pubkey_algo_doc },
-    { "hash_algo", T_OBJECT, offsetof(PyGpgmeSignature, hash_algo), READONLY,
+    { "hash_algo", (getter)pygpgme_sig_get_hash_algo, NULL,
       pygpgme_sig_hash_algo_doc },
-    { NULL, 0, 0, 0 },
+    { NULL, (getter)0, (setter)0 }
 };
 
 static const char pygpgme_sig_doc[] =
@@ -206,7 +309,7 @@ static PyType_Slot pygpgme_sig_slots[] = {
     { Py_tp_init, pygpgme_no_constructor },
 #endif
     { Py_tp_dealloc, pygpgme_sig_dealloc },
-    { Py_tp_members, pygpgme_sig_members },
+    { Py_tp_getset, pygpgme_sig_getsets },
     { Py_tp_doc, (void *)pygpgme_sig_doc },
     { 0, NULL },
 };
@@ -222,6 +325,53 @@ PyType_Spec pygpgme_sig_spec = {
     .slots = pygpgme_sig_slots,
 };
 
+/* Copies a list of notations into a single block of memory, to be
+ * freed with PyMem_Free(). */
+static int
+copy_notations(gpgme_sig_notation_t notations, gpgme_sig_notation_t *copy)
+{
+    gpgme_sig_notation_t not, item, prev = NULL;
+    size_t n_items = 0, size = 0;
+    char *strings;
+
+    *copy = NULL;
+    for (not = notations; not != NULL; not = not->next) {
+        n_items++;
+        size += not->name_len + 1 + not->value_len + 1;
+    }
+    if (n_items == 0)
+        return 0;
+
+    item = PyMem_Malloc(n_items * sizeof(*item) + size);
+    if (item == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    *copy = item;
+    strings = (char *)(item + n_items);
+
+    for (not = notations; not != NULL; not = not->next, item++) {
+        *item = *not;
+        item->next = NULL;
+        if (not->name != NULL) {
+            memcpy(strings, not->name, not->name_len);
+            strings[not->name_len] = '\0';
+            item->name = strings;
+        }
+        strings += not->name_len + 1;
+        if (not->value != NULL) {
+            memcpy(strings, not->value, not->value_len);
+            strings[not->value_len] = '\0';
+            item->value = strings;
+        }
+        strings += not->value_len + 1;
+        if (prev != NULL)
+            prev->next = item;
+        prev = item;
+    }
+    return 0;
+}
+
 PyObject *
 pygpgme_siglist_new(PyGpgmeModState *state, gpgme_signature_t siglist)
 {
@@ -229,36 +379,48 @@ pygpgme_siglist_new(PyGpgmeModState *state, gpgme_signature_t siglist)
     gpgme_signature_t sig;
 
     list = PyList_New(0);
+    if (list == NULL)
+        return NULL;
     for (sig = siglist; sig != NULL; sig = sig->next) {
-        PyGpgmeSignature *item = PyObject_New(PyGpgmeSignature,
-                                              state->Signature_Type);
+        PyGpgmeSignature *item = (PyGpgmeSignature *)
+            pygpgme_free_list_alloc(&state->Signature_free,
+                                    state->Signature_Type);
         if (item == NULL) {
             Py_DECREF(list);
             return NULL;
         }
-        item->summary = pygpgme_enum_value_new(state->Sigsum_Type, sig->summary);
+        item->summary = sig->summary;
+        item->fpr = NULL;
+        item->status = sig->status;
+        item->notations = NULL;
+        item->timestamp = sig->timestamp;
+        item->exp_timestamp = sig->exp_timestamp;
+        item->wrong_key_usage = sig->wrong_key_usage;
+        item->validity = sig->validity;
+        item->validity_reason = sig->validity_reason;
+        item->pubkey_algo = sig->pubkey_algo;
+        item->hash_algo = sig->hash_algo;
+        item->fpr_obj = NULL;
+        item->status_obj = NULL;
+        item->notations_obj = NULL;
+        item->validity_reason_obj = NULL;
+
         if (sig->fpr) {
-            item->fpr = PyUnicode_DecodeASCII(sig->fpr, strlen(sig->fpr),
-                                              "replace");
-        } else {
-            Py_INCREF(Py_None);
-            item->fpr = Py_None;
+            size_t length = strlen(sig->fpr) + 1;
+
+            item->fpr = PyMem_Malloc(length);
+            if (item->fpr == NULL)
+                PyErr_NoMemory();
+            else
+                memcpy(item->fpr, sig->fpr, length);
         }
-        item->status = pygpgme_error_object(state, sig->status);
-        item->notations = pygpgme_sig_notation_list_new(state, sig->notations);
-        item->timestamp = PyLong_FromLong(sig->timestamp);
-        item->exp_timestamp = PyLong_FromLong(sig->exp_timestamp);
-        item->wrong_key_usage = PyBool_FromLong(sig->wrong_key_usage);
-        item->validity = pygpgme_enum_value_new(state->Validity_Type, sig->validity);
-        item->validity_reason = pygpgme_error_object(state, sig->validity_reason);
-        item->pubkey_algo = pygpgme_enum_value_new(state->PubkeyAlgo_Type, sig->pubkey_algo);
-        item->hash_algo = pygpgme_enum_value_new(state->HashAlgo_Type, sig->hash_algo);
-        if (PyErr_Occurred()) {
+        if (!PyErr_Occurred())
+            copy_notations(sig->notations, &item->notations);
+        if (PyErr_Occurred() || PyList_Append(list, (PyObject *)item) < 0) {
             Py_DECREF(item);
             Py_DECREF(list);
             return NULL;
         }
-        PyList_Append(list, (PyObject *)item);
         Py_DECREF(item);
     }
     return list;
@@ -305,8 +467,11 @@ pygpgme_sig_notation_init(PyGpgmeSigNotation *self, PyObject *args, PyObject *kw
 static void
 pygpgme_sig_notation_dealloc(PyGpgmeSigNotation *self)
 {
+    PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
+
     Py_XDECREF(self->name);
     Py_XDECREF(self->value);
+    pygpgme_free_list_release(&state->SigNotation_free, (PyObject *)self);
 }
 
 static Py_ssize_t
@@ -342,7 +507,7 @@ pygpgme_sig_notation_get_flags(PyGpgmeSigNotation *self)
 {
     PyGpgmeModState *state = PyType_GetModuleState(Py_TYPE(self));
 
-    return pygpgme_enum_value_new(state->SigNotationFlags_Type, self->flags);
+    return pygpgme_enum_value_new(&state->SigNotationFlags, self->flags);
 }
 
 static PyObject *
@@ -393,8 +558,9 @@ pygpgme_sig_notation_list_new(PyGpgmeModState *state, gpgme_sig_notation_t notat
 
     list = PyList_New(0);
     for (not = notations; not != NULL; not = not->next) {
-        PyGpgmeSigNotation *item = PyObject_New(PyGpgmeSigNotation,
-                                                state->SigNotation_Type);
+        PyGpgmeSigNotation *item = (PyGpgmeSigNotation *)
+            pygpgme_free_list_alloc(&state->SigNotation_free,
+                                    state->SigNotation_Type);
         if (item == NULL) {
             Py_DECREF(list);
             return NULL;
@@ -419,3 +585,43 @@ pygpgme_sig_notation_list_new(PyGpgmeModState *state, gpgme_sig_notation_t notat
     }
     return list;
 }
+
+static PyStructSequence_Field pygpgme_verify_verdict_fields[] = {
+    { "ok", "True if the data carries an acceptable signature." },
+    { "fpr", "Fingerprint of the signing key, or None." },
+    { "summary", "The signature summary as an integer.  See :class:`Sigsum`." },
+    { NULL, NULL },
+};
+
+PyStructSequence_Desc pygpgme_verify_verdict_desc = {
+    .name = "gpgme.VerifyVerdict",
+    .doc = "The result of :meth:`Context.verify_ok`.",
+    .fields = pygpgme_verify_verdict_fields,
+    .n_in_sequence = 3,
+};
+
+/* Builds a VerifyVerdict for the given signature, which may be NULL
+ * if the data had no signatures. */
+PyObject *
+pygpgme_verify_verdict_new(PyGpgmeModState *state, int ok,
+                           gpgme_signature_t sig)
+{
+    PyObject *verdict, *fpr, *summary;
+
+    verdict = PyStructSequence_New(state->VerifyVerdict_Type);
+    if (verdict == NULL)
+        return NULL;
+
+    fpr = pygpgme_intern_ascii(state, sig != NULL ? sig->fpr : NULL);
+    summary = PyLong_FromUnsignedLong(sig != NULL ? sig->summary : 0);
+    if (fpr == NULL || summary == NULL) {
+        Py_XDECREF(fpr);
+        Py_XDECREF(summary);
+        Py_DECREF(verdict);
+        return NULL;
+    }
+    PyStructSequence_SET_ITEM(verdict, 0, PyBool_FromLong(ok));
+    PyStructSequence_SET_ITEM(verdict, 1, fpr);
+    PyStructSequence_SET_ITEM(verdict, 2, summary);
+    return verdict;
+}
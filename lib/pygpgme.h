@@ -28,6 +28,44 @@
 
 #define VER(major, minor, micro) ((major << 16) | (minor << 8) | micro)
 
+/* Protects lazily initialised fields of an object.  Without the GIL
+ * this needs a per-object critical section; with it, the GIL is
+ * enough as long as nothing in the section releases it. */
+#if PY_VERSION_HEX >= 0x030d0000
+#define PYGPGME_BEGIN_CRITICAL_SECTION(op) Py_BEGIN_CRITICAL_SECTION(op)
+#define PYGPGME_END_CRITICAL_SECTION() Py_END_CRITICAL_SECTION()
+#else
+#define PYGPGME_BEGIN_CRITICAL_SECTION(op) {
+#define PYGPGME_END_CRITICAL_SECTION() }
+#endif
+
+/* bits of the "flags" column of Context.keylist_table() */
+#define PYGPGME_KEY_FLAG_REVOKED          (1 << 0)
+#define PYGPGME_KEY_FLAG_EXPIRED          (1 << 1)
+#define PYGPGME_KEY_FLAG_DISABLED         (1 << 2)
+#define PYGPGME_KEY_FLAG_INVALID          (1 << 3)
+#define PYGPGME_KEY_FLAG_CAN_ENCRYPT      (1 << 4)
+#define PYGPGME_KEY_FLAG_CAN_SIGN         (1 << 5)
+#define PYGPGME_KEY_FLAG_CAN_CERTIFY      (1 << 6)
+#define PYGPGME_KEY_FLAG_CAN_AUTHENTICATE (1 << 7)
+#define PYGPGME_KEY_FLAG_SECRET           (1 << 8)
+
+/* most settings a Context.apply_profile() profile may list */
+#define PYGPGME_PROFILE_SETTINGS 8
+
+typedef struct _PyGpgmePassphraseProvider PyGpgmePassphraseProvider;
+struct pygpgme_status_filter;
+struct pygpgme_status_line;
+
+/* Links the objects that need fixing up in the child after fork()
+ * into a list in the module state. */
+typedef struct _PyGpgmeForkLink PyGpgmeForkLink;
+struct _PyGpgmeForkLink {
+    PyGpgmeForkLink *prev;
+    PyGpgmeForkLink *next;
+    PyObject *owner;
+};
+
 typedef struct {
     PyObject_HEAD
     gpgme_ctx_t ctx;
@@ -37,6 +75,44 @@ typedef struct {
 
     PyObject *passphrase_cb;
     PyObject *progress_cb;
+    PyGpgmePassphraseProvider *passphrase_provider;
+
+    /* The most recent progress event, guarded by progress_lock rather
+     * than mutex so it can be read while an operation is running. */
+    PyThread_type_lock progress_lock;
+    struct {
+        int recorded;
+        int has_what;
+        char what[128];
+        int type;
+        int current;
+        int total;
+    } progress;
+    /* progress_cb is only called when one of these has passed */
+    int progress_tracking;
+    double progress_interval;
+    int progress_step;
+    double progress_last_time;
+    int progress_last_percent;
+
+    /* status lines passed on to status_cb, optionally in batches */
+    PyObject *status_cb;
+    struct pygpgme_status_filter *status_filter;
+    Py_ssize_t n_status_filter;
+    struct pygpgme_status_line *status_pending;
+    Py_ssize_t n_status_pending;
+    Py_ssize_t status_batch;
+
+    /* settings replaced by apply_profile('low-latency'), indexed like
+     * the profile's settings, which apply_profile('default') puts back */
+    struct {
+        int saved;
+        int offline;
+        gpgme_pinentry_mode_t pinentry_mode;
+        char *flags[PYGPGME_PROFILE_SETTINGS];  /* NULL if not saved */
+    } profile_saved;
+
+    PyGpgmeForkLink fork_link;
 } PyGpgmeContext;
 
 typedef struct {
@@ -51,24 +127,31 @@ typedef struct {
 typedef struct {
     PyObject_HEAD
     gpgme_key_t key;
+    Py_hash_t hash;             /* -1 until computed */
+    PyObject *subkeys;          /* tuples built on first access */
+    PyObject *uids;
 } PyGpgmeKey;
 
+/* Subkeys, user IDs and key signatures point into a gpgme_key_t,
+ * and hold a reference to it rather than to the Python Key object so
+ * the Key can cache them without creating a reference cycle. */
 typedef struct {
     PyObject_HEAD
     gpgme_subkey_t subkey;
-    PyObject *parent;
+    gpgme_key_t key;
 } PyGpgmeSubkey;
 
 typedef struct {
     PyObject_HEAD
     gpgme_user_id_t user_id;
-    PyObject *parent;
+    gpgme_key_t key;
+    PyObject *signatures;
 } PyGpgmeUserId;
 
 typedef struct {
     PyObject_HEAD
     gpgme_key_sig_t key_sig;
-    PyObject *parent;
+    gpgme_key_t key;
 } PyGpgmeKeySig;
 
 typedef struct {
@@ -81,19 +164,27 @@ typedef struct {
     PyObject *sig_class;
 } PyGpgmeNewSignature;
 
+/* A copy of a gpgme_signature_t, which only lives until the next
+ * operation on the context.  Python objects for the attributes are
+ * created on first access and cached. */
 typedef struct {
     PyObject_HEAD
-    PyObject *summary;
-    PyObject *fpr;
-    PyObject *status;
-    PyObject *notations;
-    PyObject *timestamp;
-    PyObject *exp_timestamp;
-    PyObject *wrong_key_usage;
-    PyObject *validity;
-    PyObject *validity_reason;
-    PyObject *pubkey_algo;
-    PyObject *hash_algo;
+    gpgme_sigsum_t summary;
+    char *fpr;
+    gpgme_error_t status;
+    gpgme_sig_notation_t notations;
+    unsigned long timestamp;
+    unsigned long exp_timestamp;
+    unsigned int wrong_key_usage;
+    gpgme_validity_t validity;
+    gpgme_error_t validity_reason;
+    gpgme_pubkey_algo_t pubkey_algo;
+    gpgme_hash_algo_t hash_algo;
+
+    PyObject *fpr_obj;
+    PyObject *status_obj;
+    PyObject *notations_obj;
+    PyObject *validity_reason_obj;
 } PyGpgmeSignature;
 
 typedef struct {
@@ -103,6 +194,12 @@ typedef struct {
     gpgme_sig_notation_flags_t flags;
 } PyGpgmeSigNotation;
 
+struct pygpgme_import_status {
+    char *fpr;
+    gpgme_error_t result;
+    unsigned int status;
+};
+
 typedef struct {
     PyObject_HEAD
     PyObject *considered;
@@ -119,6 +216,10 @@ typedef struct {
     PyObject *secret_unchanged;
     PyObject *skipped_new_keys;
     PyObject *not_imported;
+
+    /* per-key statuses, turned into a list on first access */
+    struct pygpgme_import_status *statuses;
+    Py_ssize_t n_statuses;
     PyObject *imports;
 } PyGpgmeImportResult;
 
@@ -129,11 +230,52 @@ typedef struct {
     PyObject *fpr;
 } PyGpgmeGenkeyResult;
 
+typedef struct {
+    PyObject_HEAD
+    PyObject *unsupported_algorithm;
+    PyObject *wrong_key_usage;
+    PyObject *file_name;
+    PyObject *symkey_algo;
+    PyObject *session_key;
+} PyGpgmeDecryptResult;
+
+/* Conditions checked against each key of a keylist before a Key
+ * object is created for it.  Zero/NULL fields impose no condition. */
+typedef struct {
+    int active;
+    int can_encrypt;
+    int can_sign;
+    int exclude_expired;
+    int exclude_revoked;
+    int exclude_disabled;
+    int pubkey_algo;            /* -1 for any algorithm */
+    int min_length;
+    int max_length;
+    long expires_before;
+    long expires_after;
+    char *uid_domain;
+} PyGpgmeKeyFilter;
+
 typedef struct {
     PyObject_HEAD
     PyGpgmeContext *ctx;
+    gpgme_data_t data;          /* source of keylist_data() listings */
+    PyGpgmeKeyFilter filter;
 } PyGpgmeKeyIter;
 
+typedef struct {
+    PyObject_HEAD
+    gpgme_ctx_t ctx;            /* uses GPGME_PROTOCOL_ASSUAN */
+    PyThread_type_lock mutex;
+    PyGpgmeForkLink fork_link;
+} PyGpgmeAgentConnection;
+
+typedef struct {
+    PyObject_HEAD
+    gpgme_key_t *keys;
+    Py_ssize_t length;
+} PyGpgmeRecipientSet;
+
 extern HIDDEN PyType_Spec pygpgme_context_spec;
 extern HIDDEN PyType_Spec pygpgme_engine_info_spec;
 extern HIDDEN PyType_Spec pygpgme_key_spec;
@@ -146,6 +288,49 @@ extern HIDDEN PyType_Spec pygpgme_sig_spec;
 extern HIDDEN PyType_Spec pygpgme_sig_notation_spec;
 extern HIDDEN PyType_Spec pygpgme_import_result_spec;
 extern HIDDEN PyType_Spec pygpgme_genkey_result_spec;
+extern HIDDEN PyType_Spec pygpgme_decrypt_result_spec;
+extern HIDDEN PyType_Spec pygpgme_recipient_set_spec;
+extern HIDDEN PyType_Spec pygpgme_agent_connection_spec;
+extern HIDDEN PyStructSequence_Desc pygpgme_verify_verdict_desc;
+
+typedef struct {
+    const char *name;
+    long value;
+} PyGpgmeEnumValue;
+
+/* A static description of an enumeration.  values is terminated by
+ * an entry with a NULL name. */
+typedef struct {
+    const char *name;
+    const char *base;           /* "IntEnum" or "IntFlag" */
+    const PyGpgmeEnumValue *values;
+} PyGpgmeEnumDef;
+
+/* An enumeration type, with its members cached by value so they can
+ * be looked up without calling into the enum module.  The type is
+ * created from def on first use. */
+typedef struct {
+    const PyGpgmeEnumDef *def;
+    PyObject *type;
+    PyObject *members;          /* dict mapping int values to members */
+    PyObject **dense;           /* members indexed by value, if small */
+    long n_dense;
+    Py_ssize_t cache_limit;     /* maximum size of members */
+#ifdef Py_GIL_DISABLED
+    PyMutex mutex;
+#endif
+} PyGpgmeEnum;
+
+/* Deallocated result objects kept for reuse, chained through the
+ * first word after the object header.  Free lists are not used in
+ * free-threaded builds. */
+#define PYGPGME_FREE_LIST_SIZE 128
+
+typedef struct {
+    PyObject *head;
+    int count;
+    int closed;                 /* set once the module state is cleared */
+} PyGpgmeFreeList;
 
 typedef struct {
     PyTypeObject *Context_Type;
@@ -160,27 +345,56 @@ typedef struct {
     PyTypeObject *SigNotation_Type;
     PyTypeObject *ImportResult_Type;
     PyTypeObject *GenkeyResult_Type;
+    PyTypeObject *DecryptResult_Type;
+    PyTypeObject *RecipientSet_Type;
+    PyTypeObject *AgentConnection_Type;
+    PyTypeObject *VerifyVerdict_Type;
 
     /* enumerations and flags */
-    PyObject *DataEncoding_Type;
-    PyObject *PubkeyAlgo_Type;
-    PyObject *HashAlgo_Type;
-    PyObject *SigMode_Type;
-    PyObject *Validity_Type;
-    PyObject *Protocol_Type;
-    PyObject *KeylistMode_Type;
-    PyObject *PinentryMode_Type;
-    PyObject *ExportMode_Type;
-    PyObject *SigNotationFlags_Type;
-    PyObject *Status_Type;
-    PyObject *EncryptFlags_Type;
-    PyObject *Sigsum_Type;
-    PyObject *Import_Type;
-    PyObject *Delete_Type;
-    PyObject *ErrSource_Type;
-    PyObject *ErrCode_Type;
+    PyGpgmeEnum DataEncoding;
+    PyGpgmeEnum PubkeyAlgo;
+    PyGpgmeEnum HashAlgo;
+    PyGpgmeEnum SigMode;
+    PyGpgmeEnum Validity;
+    PyGpgmeEnum Protocol;
+    PyGpgmeEnum KeylistMode;
+    PyGpgmeEnum PinentryMode;
+    PyGpgmeEnum ExportMode;
+    PyGpgmeEnum SigNotationFlags;
+    PyGpgmeEnum Status;
+    PyGpgmeEnum EncryptFlags;
+    PyGpgmeEnum Sigsum;
+    PyGpgmeEnum Import;
+    PyGpgmeEnum Delete;
+    PyGpgmeEnum KeyFlags;
+    PyGpgmeEnum ErrSource;
+    PyGpgmeEnum ErrCode;
+
+    /* free lists for short-lived result objects */
+    PyGpgmeFreeList Subkey_free;
+    PyGpgmeFreeList UserId_free;
+    PyGpgmeFreeList KeySig_free;
+    PyGpgmeFreeList NewSignature_free;
+    PyGpgmeFreeList Signature_free;
+    PyGpgmeFreeList SigNotation_free;
 
     PyObject *pygpgme_error;
+    PyObject *strerror_cache;   /* dict mapping error values to messages */
+    PyObject *str_source;
+    PyObject *str_code;
+    PyObject *str_strerror;
+
+    /* recently used fingerprint and key ID strings */
+    PyObject **intern_table;
+#ifdef Py_GIL_DISABLED
+    PyMutex intern_mutex;
+#endif
+
+    /* contexts and agent connections, for after_fork() */
+    PyGpgmeForkLink fork_objects;
+#ifdef Py_GIL_DISABLED
+    PyMutex fork_mutex;
+#endif
 } PyGpgmeModState;
 
 HIDDEN int           pygpgme_check_error    (PyGpgmeModState *state,
@@ -190,26 +404,92 @@ HIDDEN PyObject     *pygpgme_error_object   (PyGpgmeModState *state,
 HIDDEN gpgme_error_t pygpgme_check_pyerror  (PyGpgmeModState *state);
 HIDDEN int           pygpgme_no_constructor (PyObject *self, PyObject *args,
                                              PyObject *kwargs);
+HIDDEN int           pygpgme_parse_args     (const char *fname,
+                                             PyObject *const *args,
+                                             Py_ssize_t nargs,
+                                             PyObject *kwnames,
+                                             const char *const *kwlist,
+                                             Py_ssize_t n_required,
+                                             Py_ssize_t n_positional,
+                                             PyObject **values);
+HIDDEN PyObject     *pygpgme_get_cached     (PyObject *self, PyObject **slot,
+                                             PyObject *(*make)(PyObject *self));
+HIDDEN PyObject     *pygpgme_free_list_alloc (PyGpgmeFreeList *list,
+                                              PyTypeObject *type);
+HIDDEN void          pygpgme_free_list_release (PyGpgmeFreeList *list,
+                                                PyObject *obj);
+HIDDEN void          pygpgme_free_list_clear (PyGpgmeFreeList *list);
+HIDDEN void          pygpgme_begin_allow_threads (PyGpgmeContext *self);
+HIDDEN void          pygpgme_end_allow_threads (PyGpgmeContext *self);
 
 HIDDEN PyObject     *pygpgme_engine_info_list_new(PyGpgmeModState *state,
                                                   gpgme_engine_info_t info);
+HIDDEN PyObject     *pygpgme_engine_info_snapshot(PyObject *mod,
+                                                  PyObject *unused);
+HIDDEN PyObject     *pygpgme_preseed_engine_info(PyObject *mod,
+                                                 PyObject *snapshot);
+extern HIDDEN const char pygpgme_engine_info_snapshot_doc[];
+extern HIDDEN const char pygpgme_preseed_engine_info_doc[];
+HIDDEN int           pygpgme_fork_init      (PyGpgmeModState *state,
+                                             PyObject *mod);
+HIDDEN void          pygpgme_fork_track     (PyGpgmeModState *state,
+                                             PyGpgmeForkLink *link,
+                                             PyObject *owner);
+HIDDEN void          pygpgme_fork_untrack   (PyGpgmeModState *state,
+                                             PyGpgmeForkLink *link);
+HIDDEN int           pygpgme_fork_reset_lock (PyThread_type_lock *lock);
+HIDDEN PyObject     *pygpgme_after_fork     (PyObject *mod, PyObject *unused);
+extern HIDDEN const char pygpgme_after_fork_doc[];
+HIDDEN int           pygpgme_context_after_fork (PyGpgmeContext *self);
+HIDDEN int           pygpgme_agent_connection_after_fork (PyGpgmeAgentConnection *self);
 HIDDEN int           pygpgme_data_new       (PyGpgmeModState *state,
                                              gpgme_data_t *dh, PyObject *fp,
                                              PyGpgmeContext *ctx);
 HIDDEN PyObject     *pygpgme_key_new        (PyGpgmeModState *state,
                                              gpgme_key_t key);
+HIDDEN int           pygpgme_key_filter_match (const PyGpgmeKeyFilter *filter,
+                                               gpgme_key_t key);
 HIDDEN PyObject     *pygpgme_newsiglist_new (PyGpgmeModState *state,
                                              gpgme_new_signature_t siglist);
 HIDDEN PyObject     *pygpgme_siglist_new    (PyGpgmeModState *state,
                                              gpgme_signature_t siglist);
+HIDDEN PyObject     *pygpgme_verify_verdict_new (PyGpgmeModState *state,
+                                                 int ok, gpgme_signature_t sig);
 HIDDEN PyObject     *pygpgme_sig_notation_list_new (PyGpgmeModState *state,
                                                     gpgme_sig_notation_t notations);
+HIDDEN int           pygpgme_intern_init    (PyGpgmeModState *state);
+HIDDEN void          pygpgme_intern_clear   (PyGpgmeModState *state);
+HIDDEN PyObject     *pygpgme_intern_ascii   (PyGpgmeModState *state,
+                                             const char *str);
+HIDDEN void          pygpgme_wipe           (void *buffer, size_t length);
+HIDDEN PyGpgmePassphraseProvider *pygpgme_passphrase_provider_new (PyObject *passphrase);
+HIDDEN PyGpgmePassphraseProvider *pygpgme_passphrase_keyring_new (PyObject *prefix);
+HIDDEN void          pygpgme_passphrase_provider_free (PyGpgmePassphraseProvider *provider);
+HIDDEN PyGpgmePassphraseProvider *pygpgme_passphrase_provider_copy (const PyGpgmePassphraseProvider *provider);
+HIDDEN gpgme_error_t pygpgme_passphrase_provider_cb (void *hook,
+                                                     const char *uid_hint,
+                                                     const char *passphrase_info,
+                                                     int prev_was_bad, int fd);
+HIDDEN PyObject     *pygpgme_key_table_fields (PyObject *fields);
+HIDDEN PyObject     *pygpgme_key_table_new  (PyGpgmeModState *state,
+                                             gpgme_key_t *keys,
+                                             Py_ssize_t n_keys,
+                                             PyObject *fields);
 HIDDEN PyObject     *pygpgme_import_result  (PyGpgmeModState *state,
                                              gpgme_ctx_t ctx);
 HIDDEN PyObject     *pygpgme_genkey_result  (PyGpgmeModState *state,
                                              gpgme_ctx_t ctx);
+HIDDEN PyObject     *pygpgme_decrypt_result (PyGpgmeModState *state,
+                                             gpgme_ctx_t ctx);
 
-HIDDEN void          pygpgme_add_constants  (PyObject *mod);
-HIDDEN PyObject     *pygpgme_enum_value_new (PyObject *type, long value);
+HIDDEN void          pygpgme_init_enums     (PyGpgmeModState *state);
+HIDDEN void          pygpgme_enums_after_fork (PyGpgmeModState *state);
+HIDDEN PyObject     *pygpgme_mod_getattr    (PyObject *mod, PyObject *name);
+HIDDEN PyObject     *pygpgme_mod_dir        (PyObject *mod, PyObject *unused);
+HIDDEN int           pygpgme_enum_traverse  (PyGpgmeEnum *e, visitproc visit,
+                                             void *arg);
+HIDDEN void          pygpgme_enum_clear     (PyGpgmeEnum *e);
+HIDDEN PyObject     *pygpgme_enum_type      (PyGpgmeEnum *e);
+HIDDEN PyObject     *pygpgme_enum_value_new (PyGpgmeEnum *e, long value);
 
 #endif
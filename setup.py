@@ -19,12 +19,19 @@ setup(ext_modules=[
          'lib/pygpgme-data.c',
          'lib/pygpgme-context.c',
          'lib/pygpgme-engine-info.c',
+         'lib/pygpgme-fork.c',
          'lib/pygpgme-key.c',
          'lib/pygpgme-signature.c',
          'lib/pygpgme-import.c',
          'lib/pygpgme-keyiter.c',
+         'lib/pygpgme-keytable.c',
+         'lib/pygpgme-intern.c',
+         'lib/pygpgme-passphrase.c',
+         'lib/pygpgme-agent.c',
          'lib/pygpgme-constants.c',
          'lib/pygpgme-genkey.c',
+         'lib/pygpgme-decrypt.c',
+         'lib/pygpgme-recipientset.c',
          ],
         extra_compile_args=gpgme_cflags,
         extra_link_args=gpgme_libs)
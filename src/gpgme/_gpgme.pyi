@@ -1,6 +1,7 @@
 import enum
 from typing import (
-    BinaryIO, Callable, Iterator, Literal, Optional, Sequence, Union, final)
+    BinaryIO, Callable, Iterable, Iterator, Literal, Mapping, Optional,
+    Sequence, Union, final, overload)
 
 @final
 class Context:
@@ -9,18 +10,38 @@ class Context:
     def set_engine_info(self, protocol: Protocol, file_name: Optional[str],
                         home_dir: Optional[str], /) -> None: ...
     def set_locale(self, category: int, value: Optional[str], /) -> None: ...
-    def get_key(self, fingerprint: str, secret: bool = False, /) -> Key: ...
-    def encrypt(self, recipients: Optional[Sequence[Key]],
+    def set_passphrase(self, passphrase: Union[None, str, bytes, Mapping[str, Union[str, bytes]]], /) -> None: ...
+    def set_passphrase_keyring(self, prefix: str, /) -> None: ...
+    def set_progress_throttle(self, interval: float = 0.0, step: int = 0) -> None: ...
+    def progress_snapshot(self) -> Optional[tuple[Optional[str], int, int, int]]: ...
+    @overload
+    def set_status_cb(self, callback: Union[Callable[[Status, Optional[str]], None], Callable[[list[tuple[Status, Optional[str]]]], None]],
+                      statuses: Iterable[Status], batch: int = 0) -> None: ...
+    @overload
+    def set_status_cb(self, callback: None, statuses: None = None,
+                      batch: int = 0) -> None: ...
+    def apply_profile(self, profile: Literal['default', 'low-latency'], *,
+                      trust_model: Optional[str] = None) -> dict[str, bool]: ...
+    def clone(self) -> Context: ...
+    def get_key(self, fingerprint: str, secret: bool = False) -> Key: ...
+    def encrypt(self, recipients: Union[None, Sequence[Key], RecipientSet],
                 flags: EncryptFlags | Literal[0],
-                plain: BinaryIO, cipher: BinaryIO, /) -> None: ...
-    def encrypt_sign(self, recipients: Optional[Sequence[Key]],
+                plaintext: BinaryIO, ciphertext: BinaryIO) -> None: ...
+    def encrypt_sign(self, recipients: Union[Sequence[Key], RecipientSet],
                      flags: EncryptFlags | Literal[0],
-                     plain: BinaryIO, cipher: BinaryIO, /) -> Sequence[NewSignature]: ...
-    def decrypt(self, cipher: BinaryIO, plain: BinaryIO, /) -> None: ...
-    def decrypt_verify(self, cipher: BinaryIO, plain: BinaryIO, /) -> Sequence[Signature]: ...
+                     plaintext: BinaryIO, ciphertext: BinaryIO) -> Sequence[NewSignature]: ...
+    def decrypt(self, cipher: BinaryIO, plain: BinaryIO) -> DecryptResult: ...
+    def decrypt_verify(self, cipher: BinaryIO, plain: BinaryIO) -> Sequence[Signature]: ...
+    def encrypt_symmetric(self, data: bytes, passphrase: Union[str, bytes],
+                          profile: Literal['default', 'low-latency', 'no-cache'] = 'default') -> bytes: ...
+    def decrypt_symmetric(self, data: bytes, passphrase: Union[str, bytes],
+                          profile: Literal['default', 'low-latency', 'no-cache'] = 'default') -> bytes: ...
     def sign(self, plain: BinaryIO, sig: BinaryIO,
-             sig_mode: SigMode = SigMode.NORMAL, /) -> Sequence[NewSignature]: ...
-    def verify(self, sig: BinaryIO, signed_text: Optional[BinaryIO], plaintext: Optional[BinaryIO], /) -> Sequence[Signature]: ...
+             sig_mode: SigMode = SigMode.NORMAL) -> Sequence[NewSignature]: ...
+    def verify(self, sig: BinaryIO, signed_text: Optional[BinaryIO], plaintext: Optional[BinaryIO]) -> Sequence[Signature]: ...
+    def verify_ok(self, sig: BinaryIO, signed_text: Optional[BinaryIO] = None,
+                  expected_signers: Optional[Sequence[Union[str, Key]]] = None,
+                  min_validity: Validity = Validity.MARGINAL) -> VerifyVerdict: ...
     def import_(self, keydata: BinaryIO, /) -> ImportResult: ...
     def import_keys(self, keys: Sequence[Key], /) -> ImportResult: ...
     def export(self, pattern: Union[None, str, Sequence[str]],
@@ -37,7 +58,21 @@ class Context:
     def card_edit(self, key: Key, callback: Callable[[Status, Optional[str], int], None],
                   out: BinaryIO, /) -> None: ...
     def keylist(self, pattern: Union[None, str, Sequence[str]] = None,
-                secret_only: bool = False, /) -> Iterator[Key]: ...
+                secret: bool = False, *, can_encrypt: bool = False,
+                can_sign: bool = False, exclude_expired: bool = False,
+                exclude_revoked: bool = False,
+                exclude_disabled: bool = False,
+                pubkey_algo: Optional[PubkeyAlgo] = None,
+                min_length: int = 0, max_length: int = 0,
+                expires_before: int = 0, expires_after: int = 0,
+                uid_domain: Optional[str] = None) -> Iterator[Key]: ...
+    def keylist_data(self, keydata: BinaryIO, /) -> Iterator[Key]: ...
+    def keylist_parallel(self, patterns: Union[None, str, Sequence[str]],
+                         secret: bool = False,
+                         workers: int = 4) -> list[Key]: ...
+    def keylist_table(self, pattern: Union[None, str, Sequence[str]] = None,
+                      fields: Optional[Sequence[str]] = None,
+                      secret: bool = False) -> dict[str, Union[memoryview, list[Optional[str]]]]: ...
     protocol: Protocol
     armor: bool
     textmode: bool
@@ -50,6 +85,8 @@ class Context:
     signers: Sequence[Key]
     sig_notations: Sequence[SigNotation]
     sender: Optional[str]
+    export_session_key: bool
+    override_session_key: Optional[str]
 
 @final
 class EngineInfo:
@@ -61,6 +98,9 @@ class EngineInfo:
 
 @final
 class Key:
+    def __hash__(self) -> int: ...
+    def __eq__(self, other: object) -> bool: ...
+    fpr: Optional[str]
     revoked: bool
     expired: bool
     disabled: bool
@@ -94,6 +134,7 @@ class Subkey:
     length: int
     keyid: str
     fpr: str
+    keygrip: Optional[str]
     timestamp: int
     expires: int
 
@@ -148,6 +189,15 @@ class Signature:
     pubkey_algo: PubkeyAlgo
     hash_algo: HashAlgo
 
+@final
+class VerifyVerdict(tuple[bool, Optional[str], int]):
+    @property
+    def ok(self) -> bool: ...
+    @property
+    def fpr(self) -> Optional[str]: ...
+    @property
+    def summary(self) -> int: ...
+
 @final
 class SigNotation:
     def __init__(self, name: Optional[str], value: str | bytes, flags: SigNotationFlags = SigNotationFlags.HUMAN_READABLE) -> None: ...
@@ -181,6 +231,30 @@ class GenkeyResult:
     sub: bool
     fpr: str
 
+@final
+class DecryptResult:
+    unsupported_algorithm: Optional[str]
+    wrong_key_usage: bool
+    file_name: Optional[str]
+    symkey_algo: Optional[str]
+    session_key: Optional[str]
+
+@final
+class RecipientSet:
+    def __init__(self, keys: Sequence[Key]) -> None: ...
+    def __len__(self) -> int: ...
+    def __getitem__(self, index: int) -> Key: ...
+
+@final
+class AgentConnection:
+    def __init__(self, socket: Optional[str] = None) -> None: ...
+    def transact(self, command: str, /) -> tuple[bytes, list[tuple[str, Optional[str]]]]: ...
+    def preset_passphrase(self, keygrip: str, passphrase: Union[str, bytes],
+                          timeout: int = -1) -> None: ...
+    def clear_passphrase(self, keygrip: str, /) -> None: ...
+    def keyinfo(self, keygrip: str, /) -> dict[str, Union[None, str, bool]]: ...
+    def getinfo(self, what: str, /) -> str: ...
+
 @final
 class KeyIter:
     def __iter__(self) -> KeyIter: ...
@@ -424,6 +498,17 @@ class Delete(enum.IntFlag):
     ALLOW_SECRET: int
     FORCE: int
 
+class KeyFlags(enum.IntFlag):
+    REVOKED: int
+    EXPIRED: int
+    DISABLED: int
+    INVALID: int
+    CAN_ENCRYPT: int
+    CAN_SIGN: int
+    CAN_CERTIFY: int
+    CAN_AUTHENTICATE: int
+    SECRET: int
+
 class ErrSource(enum.IntEnum):
     UNKNOWN: int
     GCRYPT: int
@@ -1035,3 +1120,7 @@ class ErrCode(enum.IntEnum):
     EXFULL: int
 
 gpgme_version: str
+
+def engine_info_snapshot() -> list[tuple[Protocol, Optional[str], Optional[str], Optional[str]]]: ...
+def preseed_engine_info(snapshot: Iterable[Sequence[object]], /) -> int: ...
+def after_fork() -> None: ...
@@ -0,0 +1,84 @@
+# pygpgme - a Python wrapper for the gpgme library
+# Copyright (C) 2006  James Henstridge
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+from io import BytesIO
+import os
+import subprocess
+import unittest
+
+import gpgme
+from tests.util import GpgHomeTestCase
+
+class AgentConnectionTestCase(GpgHomeTestCase):
+
+    import_keys = ['passphrase.pub', 'passphrase.sec']
+
+    def connect(self) -> gpgme.AgentConnection:
+        # The default socket is only looked up once per process, so
+        # point at the socket for this test's home directory.
+        socket = subprocess.check_output(
+            ['gpgconf', '--list-dirs', 'agent-socket'], text=True).strip()
+        return gpgme.AgentConnection(socket)
+
+    def get_keygrip(self) -> str:
+        ctx = gpgme.Context()
+        if hasattr(gpgme.KeylistMode, 'WITH_KEYGRIP'):
+            ctx.keylist_mode |= gpgme.KeylistMode.WITH_KEYGRIP
+        key = ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3', True)
+        keygrip = key.subkeys[0].keygrip
+        assert keygrip is not None
+        return keygrip
+
+    def test_getinfo(self) -> None:
+        agent = self.connect()
+        version = agent.getinfo('version')
+        self.assertRegex(version, r'^\d+\.\d+')
+        data, statuses = agent.transact('GETINFO version')
+        self.assertEqual(data.decode('ascii'), version)
+        self.assertRaises(gpgme.GpgmeError, agent.getinfo, 'no-such-item')
+        self.assertRaises(ValueError, agent.transact, 'GETINFO version\nBYE')
+
+    def test_preset_passphrase(self) -> None:
+        with open(os.path.join(self._gpghome, 'gpg-agent.conf'), 'a') as fp:
+            fp.write('allow-preset-passphrase\n')
+        agent = self.connect()
+        agent.transact('RELOADAGENT')
+
+        keygrip = self.get_keygrip()
+        self.assertEqual(len(keygrip), 40)
+        info = agent.keyinfo(keygrip)
+        self.assertEqual(info['keygrip'], keygrip)
+        self.assertEqual(info['type'], 'D')
+        self.assertEqual(info['cached'], False)
+
+        self.assertRaises(ValueError, agent.keyinfo, 'not-a-keygrip')
+        agent.preset_passphrase(keygrip, 'test')
+        self.assertEqual(agent.keyinfo(keygrip)['cached'], True)
+
+        # no passphrase_cb is needed while the passphrase is cached
+        ctx = gpgme.Context()
+        key = ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+        ctx.signers = [key]
+        signature = BytesIO()
+        new_sigs = ctx.sign(BytesIO(b'Hello World\n'), signature,
+                            gpgme.SigMode.CLEAR)
+        self.assertEqual(new_sigs[0].fpr,
+                         'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+
+        agent.clear_passphrase(keygrip)
+        self.assertEqual(agent.keyinfo(keygrip)['cached'], False)
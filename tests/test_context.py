@@ -15,7 +15,10 @@
 # License along with this library; if not, write to the Free Software
 # Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
+import json
 import os
+import subprocess
+import sys
 from typing import Optional
 import unittest
 
@@ -44,6 +47,32 @@ class ContextTestCase(GpgHomeTestCase):
             del ctx.protocol
         self.assertRaises(AttributeError, del_protocol, ctx)
 
+    def test_error_attributes(self) -> None:
+        ctx = gpgme.Context()
+        errors = []
+        for i in range(2):
+            with self.assertRaises(gpgme.GpgmeError) as cm:
+                ctx.protocol = 999
+            errors.append(cm.exception)
+        self.assertEqual(errors[0].source, errors[1].source)
+        self.assertEqual(errors[0].code, errors[1].code)
+        self.assertIsInstance(errors[0].strerror, str)
+        self.assertEqual(errors[0].args,
+                         (errors[0].source, errors[0].code, errors[0].strerror))
+        # messages are cached by error value
+        self.assertIs(errors[0].strerror, errors[1].strerror)
+
+    def test_constants(self) -> None:
+        # enumerations and legacy constants are created on first use
+        self.assertIs(gpgme.STATUS_EOF, gpgme.Status.EOF)
+        self.assertIs(gpgme.ERR_SOURCE_GPGME, gpgme.ErrSource.GPGME)
+        self.assertIs(gpgme._gpgme.Validity, gpgme.Validity)
+        self.assertEqual(gpgme.Validity.__module__, 'gpgme')
+        self.assertIn('ErrCode', dir(gpgme))
+        self.assertIn('PK_RSA', gpgme.__all__)
+        self.assertRaises(AttributeError, getattr, gpgme, 'NoSuchEnum')
+        self.assertRaises(AttributeError, getattr, gpgme, 'STATUS_NO_SUCH')
+
     def test_armor(self) -> None:
         ctx = gpgme.Context()
         self.assertEqual(ctx.armor, False)
@@ -78,6 +107,88 @@ class ContextTestCase(GpgHomeTestCase):
         with self.assertRaises(AttributeError):
             del ctx.offline
 
+    def test_apply_profile(self) -> None:
+        ctx = gpgme.Context()
+        ctx.pinentry_mode = gpgme.PinentryMode.CANCEL
+        report = ctx.apply_profile('low-latency')
+        self.assertEqual(set(report), {
+            'offline', 'auto-key-retrieve', 'no-auto-check-trustdb',
+            'no-symkey-cache', 'pinentry-mode'})
+        self.assertTrue(all(isinstance(v, bool) for v in report.values()))
+        self.assertEqual(report['offline'], True)
+        self.assertEqual(report['pinentry-mode'], True)
+        self.assertEqual(ctx.offline, True)
+        self.assertEqual(ctx.pinentry_mode, gpgme.PinentryMode.LOOPBACK)
+
+        # the context can still be used
+        with self.keyfile('key1.pub') as fp:
+            ctx.import_(fp)
+        self.assertTrue(ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4'))
+
+        # applying it again does not replace the saved settings
+        ctx.apply_profile('low-latency')
+        ctx.apply_profile('default')
+        self.assertEqual(ctx.offline, False)
+        self.assertEqual(ctx.pinentry_mode, gpgme.PinentryMode.CANCEL)
+
+        # with nothing saved, gpgme's defaults are used
+        ctx.apply_profile('default')
+        self.assertEqual(ctx.offline, False)
+        self.assertEqual(ctx.pinentry_mode, gpgme.PinentryMode.DEFAULT)
+
+        # the trust model is only changed on request, and put back
+        report = ctx.apply_profile('low-latency', trust_model='direct')
+        self.assertIn('trust-model', report)
+        clone = ctx.clone()
+        self.assertIn('trust-model', ctx.apply_profile('default'))
+        self.assertIn('trust-model', clone.apply_profile('default'))
+        self.assertNotIn('trust-model', ctx.apply_profile('default'))
+        self.assertRaises(TypeError, ctx.apply_profile, 'low-latency',
+                          trust_model=42)
+        self.assertRaises(ValueError, ctx.apply_profile, 'no-such-profile')
+
+    def test_clone(self) -> None:
+        with self.keyfile('key1.pub') as fp:
+            gpgme.Context().import_(fp)
+        os.environ['GNUPGHOME'] = '/no/such/dir'
+        ctx = gpgme.Context()
+        ctx.set_engine_info(gpgme.Protocol.OpenPGP, None, self._gpghome)
+        key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        def passphrase_cb(uid_hint: Optional[str], passphrase_info: Optional[str], prev_was_bad: bool, fd: int) -> None:
+            pass
+        ctx.armor = True
+        ctx.offline = True
+        ctx.include_certs = 2
+        ctx.keylist_mode = gpgme.KeylistMode.LOCAL | gpgme.KeylistMode.SIGS
+        ctx.pinentry_mode = gpgme.PinentryMode.LOOPBACK
+        ctx.sender = 'test@example.org'
+        ctx.signers = [key]
+        ctx.export_session_key = True
+        ctx.passphrase_cb = passphrase_cb
+
+        clone = ctx.clone()
+        self.assertIsInstance(clone, gpgme.Context)
+        self.assertEqual(clone.armor, True)
+        self.assertEqual(clone.textmode, False)
+        self.assertEqual(clone.offline, True)
+        self.assertEqual(clone.include_certs, 2)
+        self.assertEqual(clone.keylist_mode,
+                         gpgme.KeylistMode.LOCAL | gpgme.KeylistMode.SIGS)
+        self.assertEqual(clone.pinentry_mode, gpgme.PinentryMode.LOOPBACK)
+        self.assertEqual(clone.sender, 'test@example.org')
+        self.assertEqual([k.subkeys[0].fpr for k in clone.signers],
+                         ['E79A842DA34A1CA383F64A1546BB55F0885C65A4'])
+        self.assertEqual(clone.export_session_key, True)
+        self.assertEqual(clone.passphrase_cb, passphrase_cb)
+        # the engine home directory is copied too
+        self.assertTrue(clone.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4'))
+
+        # the two contexts are independent
+        clone.armor = False
+        clone.signers = []
+        self.assertEqual(ctx.armor, True)
+        self.assertEqual(len(ctx.signers), 1)
+
     def test_include_certs(self) -> None:
         ctx = gpgme.Context()
         self.assertEqual(ctx.include_certs, -256)
@@ -172,3 +283,42 @@ class ContextTestCase(GpgHomeTestCase):
         info = [info for info in ctx.get_engine_info()
                 if info.protocol == gpgme.Protocol.OpenPGP].pop()
         self.assertEqual(info.home_dir, self._gpghome)
+
+    def test_preseed_engine_info(self) -> None:
+        snapshot = gpgme.engine_info_snapshot()
+        openpgp = [entry for entry in snapshot
+                   if entry[0] == gpgme.Protocol.OpenPGP].pop()
+        self.assertIsInstance(openpgp[1], str)
+        self.assertIsInstance(openpgp[3], str)
+
+        # a snapshot that went through JSON matches the current setup
+        self.assertEqual(gpgme.preseed_engine_info(
+            json.loads(json.dumps(snapshot))), 0)
+
+        try:
+            self.assertEqual(gpgme.preseed_engine_info(
+                [(gpgme.Protocol.OpenPGP, openpgp[1], self._gpghome)]), 1)
+            ctx = gpgme.Context()
+            info = [info for info in ctx.get_engine_info()
+                    if info.protocol == gpgme.Protocol.OpenPGP].pop()
+            self.assertEqual(info.home_dir, self._gpghome)
+        finally:
+            gpgme.preseed_engine_info(snapshot)
+        self.assertEqual(gpgme.preseed_engine_info(snapshot), 0)
+
+        self.assertRaises(TypeError, gpgme.preseed_engine_info, [(0,)])
+
+    def test_preseed_engine_info_new_process(self) -> None:
+        # the first context of a fresh process uses the preseeded engine
+        openpgp = [entry for entry in gpgme.engine_info_snapshot()
+                   if entry[0] == gpgme.Protocol.OpenPGP].pop()
+        snapshot = [(openpgp[0], openpgp[1], self._gpghome)]
+        output = subprocess.check_output(
+            [sys.executable, '-c',
+             'import json, sys, gpgme\n'
+             'gpgme.preseed_engine_info(json.loads(sys.argv[1]))\n'
+             'for info in gpgme.Context().get_engine_info():\n'
+             '    if info.protocol == gpgme.Protocol.OpenPGP:\n'
+             '        print(json.dumps([info.file_name, info.home_dir]))\n',
+             json.dumps(snapshot)], text=True)
+        self.assertEqual(json.loads(output), [openpgp[1], self._gpghome])
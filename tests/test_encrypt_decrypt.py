@@ -108,6 +108,19 @@ class EncryptDecryptTestCase(GpgHomeTestCase):
         ctx.decrypt(ciphertext, plaintext)
         self.assertEqual(plaintext.getvalue(), b'Hello World\n')
 
+    def test_encrypt_recipient_generator(self) -> None:
+        # the generator holds the only references to the keys
+        ctx = gpgme.Context()
+        ciphertext = BytesIO()
+        ctx.encrypt((ctx.get_key(fpr) for fpr in
+                     ['93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F']),
+                    gpgme.EncryptFlags.ALWAYS_TRUST,
+                    BytesIO(b'Hello World\n'), ciphertext)
+        ciphertext.seek(0)
+        plaintext = BytesIO()
+        ctx.decrypt(ciphertext, plaintext)
+        self.assertEqual(plaintext.getvalue(), b'Hello World\n')
+
     def test_encrypt_armor(self) -> None:
         plaintext = BytesIO(b'Hello World\n')
         ciphertext = BytesIO()
@@ -123,6 +136,46 @@ class EncryptDecryptTestCase(GpgHomeTestCase):
         ctx.decrypt(ciphertext, plaintext)
         self.assertEqual(plaintext.getvalue(), b'Hello World\n')
 
+    def test_session_key(self) -> None:
+        plaintext = BytesIO(b'Hello World\n')
+        ciphertext = BytesIO()
+        ctx = gpgme.Context()
+        recipient = ctx.get_key('93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F')
+        ctx.encrypt([recipient], gpgme.EncryptFlags.ALWAYS_TRUST,
+                    plaintext, ciphertext)
+
+        ciphertext.seek(0)
+        plaintext = BytesIO()
+        result = ctx.decrypt(ciphertext, plaintext)
+        self.assertIsInstance(result, gpgme.DecryptResult)
+        self.assertEqual(result.session_key, None)
+        self.assertEqual(result.wrong_key_usage, False)
+
+        self.assertEqual(ctx.export_session_key, False)
+        ctx.export_session_key = True
+        self.assertEqual(ctx.export_session_key, True)
+        ciphertext.seek(0)
+        plaintext = BytesIO()
+        result = ctx.decrypt(ciphertext, plaintext)
+        session_key = result.session_key
+        assert session_key is not None
+        self.assertRegex(session_key, r'^\d+:[0-9A-F]+$')
+
+        # the session key is enough to decrypt without the secret key
+        ctx.delete(ctx.get_key('93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F'),
+                   gpgme.Delete.ALLOW_SECRET | gpgme.Delete.FORCE)
+        ctx = gpgme.Context()
+        self.assertEqual(ctx.override_session_key, None)
+        ctx.override_session_key = session_key
+        self.assertEqual(ctx.override_session_key, session_key)
+        ciphertext.seek(0)
+        plaintext = BytesIO()
+        ctx.decrypt(ciphertext, plaintext)
+        self.assertEqual(plaintext.getvalue(), b'Hello World\n')
+
+        ctx.override_session_key = None
+        self.assertEqual(ctx.override_session_key, None)
+
     def test_encrypt_symmetric(self) -> None:
         plaintext = BytesIO(b'Hello World\n')
         ciphertext = BytesIO()
@@ -141,6 +194,32 @@ class EncryptDecryptTestCase(GpgHomeTestCase):
         ctx.decrypt(ciphertext, plaintext)
         self.assertEqual(plaintext.getvalue(), b'Hello World\n')
 
+    def test_encrypt_symmetric_buffer(self) -> None:
+        ctx = gpgme.Context()
+        for profile in ['default', 'low-latency', 'no-cache']:
+            ciphertext = ctx.encrypt_symmetric(b'Hello World\n',
+                                               'Symmetric passphrase',
+                                               profile=profile)
+            self.assertNotIn(b'Hello World', ciphertext)
+            plaintext = ctx.decrypt_symmetric(ciphertext,
+                                              b'Symmetric passphrase',
+                                              profile=profile)
+            self.assertEqual(plaintext, b'Hello World\n')
+
+        # the context's own passphrase settings are left alone
+        self.assertEqual(ctx.passphrase_cb, None)
+
+        ctx.armor = True
+        ciphertext = ctx.encrypt_symmetric(memoryview(b'Hello World\n'),
+                                           'Symmetric passphrase')
+        self.assertTrue(ciphertext.startswith(b'-----BEGIN PGP MESSAGE-----'))
+        self.assertRaises(gpgme.GpgmeError, ctx.decrypt_symmetric,
+                          ciphertext, 'wrong passphrase', profile='no-cache')
+
+        self.assertRaises(ValueError, ctx.encrypt_symmetric, b'data', 'pw',
+                          profile='no-such-profile')
+        self.assertRaises(TypeError, ctx.encrypt_symmetric, b'data', None)
+
     def test_encrypt_sign(self) -> None:
         plaintext = BytesIO(b'Hello World\n')
         ciphertext = BytesIO()
@@ -171,6 +250,37 @@ class EncryptDecryptTestCase(GpgHomeTestCase):
         self.assertEqual(sigs[0].validity, gpgme.Validity.UNKNOWN)
         self.assertEqual(sigs[0].validity_reason, None)
 
+    def test_encrypt_recipient_set(self) -> None:
+        ctx = gpgme.Context()
+        recipients = gpgme.RecipientSet([
+            ctx.get_key('93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F'),
+            ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')])
+        self.assertEqual(len(recipients), 2)
+        self.assertEqual(recipients[0].subkeys[0].fpr,
+                         '93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F')
+
+        for message in [b'Hello World\n', b'Goodbye World\n']:
+            plaintext = BytesIO(message)
+            ciphertext = BytesIO()
+            ctx.encrypt(recipients, gpgme.EncryptFlags.ALWAYS_TRUST,
+                        plaintext, ciphertext)
+
+            # rewind ciphertext buffer, and try to decrypt:
+            ciphertext.seek(0)
+            plaintext = BytesIO()
+            ctx.decrypt(ciphertext, plaintext)
+            self.assertEqual(plaintext.getvalue(), message)
+
+    def test_recipient_set_rejects_signonly(self) -> None:
+        ctx = gpgme.Context()
+        key = ctx.get_key('15E7CE9BF1771A4ABC550B31F540A569CB935A42')
+        with self.assertRaises(ValueError):
+            gpgme.RecipientSet([key])
+        with self.assertRaises(ValueError):
+            gpgme.RecipientSet([])
+        with self.assertRaises(TypeError):
+            gpgme.RecipientSet(['93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F'])
+
     def test_encrypt_to_signonly(self) -> None:
         plaintext = BytesIO(b'Hello World\n')
         ciphertext = BytesIO()
@@ -0,0 +1,146 @@
+# pygpgme - a Python wrapper for the gpgme library
+# Copyright (C) 2006  James Henstridge
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+import gc
+import importlib.util
+from io import BytesIO
+import os
+import subprocess
+import threading
+import traceback
+from typing import Callable, Optional
+import unittest
+import warnings
+import weakref
+
+import gpgme
+from tests.util import GpgHomeTestCase
+
+@unittest.skipUnless(hasattr(os, 'fork'), 'os.fork() is not available')
+class ForkTestCase(GpgHomeTestCase):
+
+    import_keys = ['key1.pub', 'passphrase.pub', 'passphrase.sec']
+
+    def run_in_child(self, func: Callable[[], None]) -> None:
+        with warnings.catch_warnings():
+            # forking with other threads running is deliberate here
+            warnings.simplefilter('ignore', DeprecationWarning)
+            pid = os.fork()
+        if pid == 0:
+            status = 1
+            try:
+                func()
+                status = 0
+            except BaseException:
+                traceback.print_exc()
+            finally:
+                os._exit(status)
+        _, status = os.waitpid(pid, 0)
+        self.assertEqual(os.waitstatus_to_exitcode(status), 0)
+
+    def test_idle_objects(self) -> None:
+        ctx = gpgme.Context()
+        ctx.armor = True
+        socket = subprocess.check_output(
+            ['gpgconf', '--list-dirs', 'agent-socket'], text=True).strip()
+        agent = gpgme.AgentConnection(socket)
+        version = agent.getinfo('version')
+
+        def child() -> None:
+            assert ctx.armor
+            key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+            assert key.subkeys[0].fpr == 'E79A842DA34A1CA383F64A1546BB55F0885C65A4'
+            assert agent.getinfo('version') == version
+            gpgme.after_fork()
+            ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        self.run_in_child(child)
+
+        # the child did not close the parent's agent session
+        self.assertEqual(agent.getinfo('version'), version)
+
+    def test_busy_context(self) -> None:
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')]
+        entered = threading.Event()
+        release = threading.Event()
+        def passphrase_cb(uid_hint: Optional[str], passphrase_info: Optional[str], prev_was_bad: bool, fd: int) -> None:
+            entered.set()
+            release.wait()
+            os.write(fd, b'test\n')
+        ctx.passphrase_cb = passphrase_cb
+
+        results: list[list[gpgme.NewSignature]] = []
+        thread = threading.Thread(target=lambda: results.append(
+            ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                     gpgme.SigMode.CLEAR)))
+        thread.start()
+        try:
+            self.assertTrue(entered.wait(30))
+
+            # the context is locked by the signing thread, which does
+            # not exist in the child
+            def child() -> None:
+                ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+                assert ctx.passphrase_cb is passphrase_cb
+            self.run_in_child(child)
+        finally:
+            release.set()
+            thread.join()
+        self.assertEqual(results[0][0].fpr,
+                         'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+
+    def test_fork_in_callback(self) -> None:
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')]
+
+        def child() -> None:
+            # the signing operation still holds the context's lock
+            # in this thread, so another thread has to wait for it
+            thread = threading.Thread(
+                target=ctx.get_key,
+                args=('E79A842DA34A1CA383F64A1546BB55F0885C65A4',),
+                daemon=True)
+            thread.start()
+            thread.join(1)
+            assert thread.is_alive()
+
+        errors: list[BaseException] = []
+        def passphrase_cb(uid_hint: Optional[str], passphrase_info: Optional[str], prev_was_bad: bool, fd: int) -> None:
+            try:
+                self.run_in_child(child)
+            except BaseException as exc:
+                errors.append(exc)
+            os.write(fd, b'test\n')
+        ctx.passphrase_cb = passphrase_cb
+
+        new_sigs = ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                            gpgme.SigMode.CLEAR)
+        self.assertEqual(errors, [])
+        self.assertEqual(new_sigs[0].fpr,
+                         'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+
+    def test_module_can_be_freed(self) -> None:
+        # the at-fork hook must not keep a module instance alive
+        spec = gpgme._gpgme.__spec__
+        assert spec is not None and spec.loader is not None
+        mod = importlib.util.module_from_spec(spec)
+        spec.loader.exec_module(mod)
+        ref = weakref.ref(mod)
+        del mod
+        gc.collect()
+        self.assertIsNone(ref())
@@ -165,6 +165,19 @@ class ImportTestCase(GpgHomeTestCase):
         # can we get the public key?
         key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
 
+    def test_import_result_outlives_operation(self) -> None:
+        ctx = gpgme.Context()
+        with self.keyfile('key1.pub') as fp:
+            result = ctx.import_(fp)
+        with self.keyfile('key2.pub') as fp:
+            ctx.import_(fp)
+
+        # the per-key statuses are only converted on first access
+        self.assertEqual(result.imports,
+                         [('E79A842DA34A1CA383F64A1546BB55F0885C65A4',
+                           None, gpgme.Import.NEW)])
+        self.assertIs(result.imports, result.imports)
+
     def test_import_keys(self) -> None:
         ctx = gpgme.Context()
         with self.keyfile('signonly.pub') as fp:
@@ -63,3 +63,108 @@ class KeylistTestCase(GpgHomeTestCase):
         keyids = set(key.subkeys[0].keyid
                      for key in ctx.keylist(None, True))
         self.assertTrue(keyids, set(['46BB55F0885C65A4']))
+
+    def test_list_filter_capabilities(self) -> None:
+        ctx = gpgme.Context()
+        keyids = set(key.subkeys[0].keyid
+                     for key in ctx.keylist(can_encrypt=True))
+        self.assertEqual(keyids, {'46BB55F0885C65A4', '2CF46B7FC97E6B0F'})
+        keyids = set(key.subkeys[0].keyid
+                     for key in ctx.keylist(exclude_revoked=True))
+        self.assertEqual(keyids, {'46BB55F0885C65A4', '2CF46B7FC97E6B0F',
+                                  'F540A569CB935A42'})
+
+    def test_list_filter_algorithm(self) -> None:
+        ctx = gpgme.Context()
+        keyids = set(key.subkeys[0].keyid
+                     for key in ctx.keylist(pubkey_algo=gpgme.PubkeyAlgo.RSA))
+        self.assertEqual(keyids, {'2CF46B7FC97E6B0F', 'F540A569CB935A42'})
+        keyids = set(key.subkeys[0].keyid
+                     for key in ctx.keylist(max_length=2048))
+        self.assertEqual(keyids, {'46BB55F0885C65A4', '2EF658C987754368'})
+        keyids = set(key.subkeys[0].keyid
+                     for key in ctx.keylist('@example.org', min_length=2048))
+        self.assertEqual(keyids, {'2CF46B7FC97E6B0F', 'F540A569CB935A42'})
+
+    def test_list_filter_expiry(self) -> None:
+        ctx = gpgme.Context()
+        # none of the test keys expire
+        self.assertEqual(list(ctx.keylist(expires_before=2**31 - 1)), [])
+        self.assertEqual(len(list(ctx.keylist(expires_after=2**31 - 1))), 4)
+
+    def test_list_filter_uid_domain(self) -> None:
+        ctx = gpgme.Context()
+        keyids = set(key.subkeys[0].keyid
+                     for key in ctx.keylist(uid_domain='EXAMPLE.com'))
+        self.assertEqual(keyids, {'F540A569CB935A42'})
+
+    def test_keylist_table(self) -> None:
+        ctx = gpgme.Context()
+        table = ctx.keylist_table(['key1@example.org', 'key2@example.org',
+                                   'revoked@example.org'])
+        self.assertEqual(sorted(table['fpr']), [
+            '93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F',
+            'B6525A39EB81F88B4D2CFB3E2EF658C987754368',
+            'E79A842DA34A1CA383F64A1546BB55F0885C65A4'])
+        rows = {fpr: i for i, fpr in enumerate(table['fpr'])}
+
+        key1 = rows['E79A842DA34A1CA383F64A1546BB55F0885C65A4']
+        self.assertEqual(table['keyid'][key1], '46BB55F0885C65A4')
+        self.assertEqual(table['uid'][key1], 'Key 1 <key1@example.org>')
+        self.assertEqual(table['timestamp'][key1], 1137568227)
+        self.assertEqual(table['expires'][key1], 0)
+        self.assertEqual(table['pubkey_algo'][key1], gpgme.PubkeyAlgo.DSA)
+        self.assertEqual(table['length'][key1], 1024)
+        self.assertEqual(table['flags'][key1] & gpgme.KeyFlags.CAN_ENCRYPT,
+                         gpgme.KeyFlags.CAN_ENCRYPT)
+
+        revoked = rows['B6525A39EB81F88B4D2CFB3E2EF658C987754368']
+        self.assertEqual(table['flags'][revoked] & gpgme.KeyFlags.REVOKED,
+                         gpgme.KeyFlags.REVOKED)
+
+        # numeric columns are contiguous buffers
+        self.assertIsInstance(table['timestamp'], memoryview)
+        self.assertEqual(table['timestamp'].format, 'q')
+        self.assertTrue(table['timestamp'].contiguous)
+        self.assertEqual(len(table['timestamp']), 3)
+
+    def test_keylist_table_fields(self) -> None:
+        ctx = gpgme.Context()
+        table = ctx.keylist_table('key2@example.org', fields=['fpr', 'length'])
+        self.assertEqual(set(table), {'fpr', 'length'})
+        self.assertEqual(table['fpr'],
+                         ['93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F'])
+        self.assertEqual(table['length'].tolist(), [4096])
+        with self.assertRaises(ValueError):
+            ctx.keylist_table(fields=['no-such-field'])
+
+    def test_keylist_data(self) -> None:
+        ctx = gpgme.Context()
+        with self.keyfile('passphrase.pub') as fp:
+            keys = list(ctx.keylist_data(fp))
+        self.assertEqual(len(keys), 1)
+        self.assertEqual(keys[0].subkeys[0].fpr,
+                         'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+        self.assertEqual(keys[0].uids[0].email, 'passphrase@example.org')
+
+        # the key has not been imported
+        self.assertEqual(list(ctx.keylist('passphrase@example.org')), [])
+
+    def test_keylist_parallel(self) -> None:
+        ctx = gpgme.Context()
+        keys = ctx.keylist_parallel(['key1@example.org', 'key2@example.org',
+                                     'signonly@example.com', 'Key 1',
+                                     '@example.org'], workers=3)
+        fprs = [key.subkeys[0].fpr for key in keys]
+        self.assertEqual(sorted(fprs), [
+            '15E7CE9BF1771A4ABC550B31F540A569CB935A42',
+            '93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F',
+            'B6525A39EB81F88B4D2CFB3E2EF658C987754368',
+            'E79A842DA34A1CA383F64A1546BB55F0885C65A4'])
+
+    def test_keylist_parallel_secret(self) -> None:
+        ctx = gpgme.Context()
+        keys = ctx.keylist_parallel(['key1@example.org', 'key2@example.org'],
+                                    secret=True)
+        self.assertEqual([key.subkeys[0].fpr for key in keys],
+                         ['E79A842DA34A1CA383F64A1546BB55F0885C65A4'])
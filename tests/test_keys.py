@@ -138,6 +138,62 @@ class KeyTestCase(GpgHomeTestCase):
         self.assertEqual(key.uids[0].email, 'key2@example.org')
         self.assertEqual(key.uids[0].comment, '')
 
+    def test_enum_attributes(self) -> None:
+        ctx = gpgme.Context()
+        key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        # enumeration values are the canonical members, not copies
+        self.assertIs(key.protocol, gpgme.Protocol.OpenPGP)
+        self.assertIs(key.subkeys[0].pubkey_algo, gpgme.PubkeyAlgo.DSA)
+        self.assertIs(key.subkeys[1].pubkey_algo, gpgme.PubkeyAlgo.ELG_E)
+        self.assertIs(key.uids[0].validity, gpgme.Validity.UNKNOWN)
+        self.assertIs(key.owner_trust, key.owner_trust)
+        self.assertIsInstance(key.keylist_mode, gpgme.KeylistMode)
+
+    def test_sequences_cached(self) -> None:
+        ctx = gpgme.Context()
+        ctx.keylist_mode = gpgme.KeylistMode.SIGS
+        key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        self.assertIsInstance(key.subkeys, tuple)
+        self.assertIs(key.subkeys, key.subkeys)
+        self.assertIs(key.uids, key.uids)
+        self.assertIs(key.uids[0].signatures, key.uids[0].signatures)
+        self.assertGreater(len(key.uids[0].signatures), 0)
+
+        # children remain usable after the key is gone
+        subkey = key.subkeys[0]
+        uid = key.uids[0]
+        sig = uid.signatures[0]
+        del key
+        self.assertEqual(subkey.fpr, 'E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        self.assertEqual(uid.email, 'key1@example.org')
+        self.assertEqual(sig.keyid, '46BB55F0885C65A4')
+
+    def test_hash_and_equality(self) -> None:
+        ctx = gpgme.Context()
+        key1 = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        key1_again = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        key2 = ctx.get_key('93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F')
+        self.assertEqual(key1.fpr, 'E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        self.assertIsNot(key1, key1_again)
+        self.assertEqual(key1, key1_again)
+        self.assertEqual(hash(key1), hash(key1_again))
+        self.assertNotEqual(key1, key2)
+        self.assertNotEqual(key1, key1.fpr)
+
+        keys = set(ctx.keylist()) | set(ctx.keylist('key1@example.org'))
+        self.assertEqual(len(keys), len(list(ctx.keylist())))
+        self.assertIn(key1_again, keys)
+        self.assertEqual({key1: 'first'}[key1_again], 'first')
+
+    def test_fingerprints_shared(self) -> None:
+        ctx = gpgme.Context()
+        key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        key_again = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        # repeated fingerprints and key IDs share one str object
+        self.assertIs(key.subkeys[0].fpr, key_again.subkeys[0].fpr)
+        self.assertIs(key.subkeys[0].keyid, key_again.subkeys[0].keyid)
+        self.assertIs(key.fpr, key.subkeys[0].fpr)
+
     def test_revoked(self) -> None:
         ctx = gpgme.Context()
         key = ctx.get_key('B6525A39EB81F88B4D2CFB3E2EF658C987754368')
@@ -17,6 +17,9 @@
 
 from io import BytesIO
 import os
+import shutil
+import subprocess
+import sys
 from textwrap import dedent
 from typing import Optional
 import unittest
@@ -76,3 +79,102 @@ class PassphraseTestCase(GpgHomeTestCase):
         self.assertEqual(new_sigs[0].type, gpgme.SigMode.CLEAR)
         self.assertEqual(new_sigs[0].fpr,
                         'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+
+    def clear_passphrase_cache(self) -> None:
+        # otherwise gpg-agent answers from its cache, without asking
+        # the passphrase provider
+        subprocess.check_call(['gpg-connect-agent', 'RELOADAGENT', '/bye'],
+                              stdout=subprocess.DEVNULL,
+                              stderr=subprocess.DEVNULL)
+
+    def test_sign_with_passphrase(self) -> None:
+        ctx = gpgme.Context()
+        key = ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+        ctx.signers = [key]
+        ctx.set_passphrase('test')
+        self.assertEqual(ctx.passphrase_cb, None)
+        new_sigs = ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                            gpgme.SigMode.CLEAR)
+        self.assertEqual(new_sigs[0].fpr,
+                        'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+
+        # keys may be given as key IDs, fingerprints or user IDs
+        for name in ['54dcbbc8dbfb9eb3', '0x54DCBBC8DBFB9EB3',
+                     'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3',
+                     'Passphrase (test) <passphrase@example.org>']:
+            self.clear_passphrase_cache()
+            ctx.set_passphrase({name: b'test'})
+            new_sigs = ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                                gpgme.SigMode.CLEAR)
+            self.assertEqual(len(new_sigs), 1)
+
+    def add_user_key(self, description: str, payload: bytes) -> None:
+        if shutil.which('keyctl') is None:
+            self.skipTest('keyctl is not installed')
+        proc = subprocess.run(['keyctl', 'padd', 'user', description, '@s'],
+                              input=payload, stdout=subprocess.PIPE,
+                              stderr=subprocess.DEVNULL)
+        if proc.returncode != 0:
+            self.skipTest('the kernel keyring is not available')
+        self.addCleanup(subprocess.call,
+                        ['keyctl', 'unlink', proc.stdout.strip(), '@s'],
+                        stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+    @unittest.skipUnless(sys.platform.startswith('linux'),
+                         'the kernel keyring is only available on Linux')
+    def test_sign_with_passphrase_keyring(self) -> None:
+        prefix = 'pygpgme-test-{}:'.format(os.getpid())
+        # only the first line of the key is used
+        self.add_user_key(prefix + '54DCBBC8DBFB9EB3', b'test\nignored\n')
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')]
+        ctx.set_passphrase_keyring(prefix)
+        self.assertEqual(ctx.passphrase_cb, None)
+        new_sigs = ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                            gpgme.SigMode.CLEAR)
+        self.assertEqual(new_sigs[0].fpr,
+                        'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+
+        self.clear_passphrase_cache()
+        ctx.set_passphrase_keyring(prefix + 'missing:')
+        with self.assertRaises(gpgme.GpgmeError):
+            ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                     gpgme.SigMode.CLEAR)
+        self.assertRaises(TypeError, ctx.set_passphrase_keyring, 42)
+
+    def test_clone_with_passphrase(self) -> None:
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')]
+        ctx.set_passphrase({'54DCBBC8DBFB9EB3': 'test'})
+        clone = ctx.clone()
+        # the clone keeps its own copy of the passphrase
+        ctx.set_passphrase('wrong')
+        new_sigs = clone.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                              gpgme.SigMode.CLEAR)
+        self.assertEqual(new_sigs[0].fpr,
+                        'EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+
+    def test_sign_with_wrong_passphrase(self) -> None:
+        ctx = gpgme.Context()
+        key = ctx.get_key('EFB052B4230BBBC51914BCBB54DCBBC8DBFB9EB3')
+        ctx.signers = [key]
+        for passphrase in ['wrong', {'15E7CE9BF1771A4A': 'test'}]:
+            ctx.set_passphrase(passphrase)
+            with self.assertRaises(gpgme.GpgmeError):
+                ctx.sign(BytesIO(b'Hello World\n'), BytesIO(),
+                         gpgme.SigMode.CLEAR)
+
+    def test_set_passphrase_errors(self) -> None:
+        ctx = gpgme.Context()
+        self.assertRaises(ValueError, ctx.set_passphrase, 'a\nb')
+        self.assertRaises(TypeError, ctx.set_passphrase, 42)
+        self.assertRaises(TypeError, ctx.set_passphrase, {1: 'test'})
+        # short key IDs can not be matched against passphrase requests
+        self.assertRaises(ValueError, ctx.set_passphrase, {'DBFB9EB3': 'test'})
+        self.assertRaises(ValueError, ctx.set_passphrase, {'0xABC': 'test'})
+        # setting a Python callback replaces the provider
+        ctx.set_passphrase('test')
+        ctx.passphrase_cb = self.passphrase_cb
+        self.assertEqual(ctx.passphrase_cb, self.passphrase_cb)
+        ctx.set_passphrase(None)
+        self.assertEqual(ctx.passphrase_cb, None)
@@ -48,3 +48,52 @@ class ProgressTestCase(GpgHomeTestCase):
         self.assertEqual(new_sigs[0].type, gpgme.SigMode.CLEAR)
         self.assertEqual(new_sigs[0].fpr,
                         'E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+
+    def test_progress_throttle(self) -> None:
+        ctx = gpgme.Context()
+        key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        ctx.signers = [key]
+        self.assertEqual(ctx.progress_snapshot(), None)
+        self.assertRaises(ValueError, ctx.set_progress_throttle, -1.0)
+
+        # events are recorded without a callback once throttled
+        ctx.set_progress_throttle(interval=60.0, step=50)
+        self.assertEqual(ctx.progress_cb, None)
+        ctx.sign(BytesIO(b'Hello World\n'), BytesIO(), gpgme.SigMode.CLEAR)
+        snapshot = ctx.progress_snapshot()
+        assert snapshot is not None
+        what, type_, current, total = snapshot
+        self.assertIsInstance(current, int)
+        self.assertIsInstance(total, int)
+
+        # the first event of a stage is always passed on
+        events: list[tuple[Optional[str], int, int, int]] = []
+        ctx.progress_cb = lambda *args: events.append(args)
+        ctx.sign(BytesIO(b'Hello World\n'), BytesIO(), gpgme.SigMode.CLEAR)
+        self.assertGreater(len(events), 0)
+
+    def test_progress_throttle_suppresses_events(self) -> None:
+        # gpg reports reading the input when it starts and again at the
+        # end.  The size of the input is not known, so only the first
+        # report starts a stage, and the second falls inside the interval.
+        plaintext = b'x' * 65536
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')]
+        unthrottled: list[tuple[Optional[str], int, int, int]] = []
+        ctx.progress_cb = lambda *args: unthrottled.append(args)
+        ctx.sign(BytesIO(plaintext), BytesIO(), gpgme.SigMode.NORMAL)
+
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')]
+        throttled: list[tuple[Optional[str], int, int, int]] = []
+        ctx.progress_cb = lambda *args: throttled.append(args)
+        ctx.set_progress_throttle(interval=60.0)
+        ctx.sign(BytesIO(plaintext), BytesIO(), gpgme.SigMode.NORMAL)
+
+        self.assertGreater(len(throttled), 0)
+        self.assertLess(len(throttled), len(unthrottled))
+        # the suppressed report at the end was still recorded
+        snapshot = ctx.progress_snapshot()
+        assert snapshot is not None
+        self.assertEqual(throttled[-1][2], 0)
+        self.assertGreater(snapshot[2], 0)
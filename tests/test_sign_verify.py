@@ -213,6 +213,99 @@ class SignVerifyTestCase(GpgHomeTestCase):
         else:
             self.fail('gpgme.GpgmeError not raised')
 
+    def test_verify_ok(self) -> None:
+        ctx = gpgme.Context()
+        key1 = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        ctx.signers = [key1]
+        signature = BytesIO()
+        ctx.sign(BytesIO(b'Hello World\n'), signature, gpgme.SigMode.NORMAL)
+
+        def verify_ok(**kwargs):
+            signature.seek(0)
+            kwargs.setdefault('min_validity', gpgme.Validity.UNKNOWN)
+            return ctx.verify_ok(signature, **kwargs)
+
+        # The signing key's validity is unknown in the test keyring,
+        # so it is rejected unless min_validity is lowered.
+        signature.seek(0)
+        verdict = ctx.verify_ok(signature)
+        self.assertEqual(verdict, (
+            False, 'E79A842DA34A1CA383F64A1546BB55F0885C65A4', 0))
+        self.assertFalse(verify_ok(min_validity=gpgme.Validity.MARGINAL).ok)
+
+        verdict = verify_ok()
+        self.assertIsInstance(verdict, gpgme.VerifyVerdict)
+        self.assertEqual(verdict, (
+            True, 'E79A842DA34A1CA383F64A1546BB55F0885C65A4', 0))
+        self.assertEqual(verdict.ok, True)
+        self.assertEqual(verdict.fpr,
+                         'E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        self.assertEqual(verdict.summary, 0)
+
+        self.assertTrue(verify_ok(expected_signers=[
+            'e79a842da34a1ca383f64a1546bb55f0885c65a4']).ok)
+        self.assertTrue(verify_ok(expected_signers=[key1]).ok)
+        verdict = verify_ok(expected_signers=[
+            '93C2240D6B8AA10AB28F701D2CF46B7FC97E6B0F'])
+        self.assertEqual(verdict.ok, False)
+        self.assertEqual(verdict.fpr,
+                         'E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+
+        self.assertFalse(verify_ok(min_validity=gpgme.Validity.FULL).ok)
+
+        self.assertRaises(TypeError, verify_ok, expected_signers=[42])
+
+    def test_verify_ok_detached(self) -> None:
+        signature = BytesIO(dedent('''
+            -----BEGIN PGP SIGNATURE-----
+            Version: GnuPG v1.4.1 (GNU/Linux)
+
+            iD8DBQBDz7ReRrtV8IhcZaQRAtuUAJwMiJeS5QPohToxA3+vp+z5c3jr1wCdHhGP
+            hhSTiguzgSYNwKSuV6SLGOM=
+            =dyZS
+            -----END PGP SIGNATURE-----
+            ''').encode('ASCII'))
+        ctx = gpgme.Context()
+        verdict = ctx.verify_ok(signature, BytesIO(b'Hello World\n'),
+                                min_validity=gpgme.Validity.UNKNOWN)
+        self.assertEqual(verdict, (
+            True, 'E79A842DA34A1CA383F64A1546BB55F0885C65A4', 0))
+
+        signature.seek(0)
+        verdict = ctx.verify_ok(signature, BytesIO(b'Hello World!\n'),
+                                min_validity=gpgme.Validity.UNKNOWN)
+        self.assertEqual(verdict.ok, False)
+        self.assertTrue(verdict.summary & gpgme.Sigsum.RED)
+
+    def test_sign_verify_keywords(self) -> None:
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key(
+            fingerprint='E79A842DA34A1CA383F64A1546BB55F0885C65A4')]
+        signature = BytesIO()
+        new_sigs = ctx.sign(plain=BytesIO(b'Hello World\n'), sig=signature,
+                            sig_mode=gpgme.SigMode.DETACH)
+        self.assertEqual(len(new_sigs), 1)
+        self.assertEqual(new_sigs[0].type, gpgme.SigMode.DETACH)
+
+        signature.seek(0)
+        sigs = ctx.verify(signature, signed_text=BytesIO(b'Hello World\n'),
+                          plaintext=None)
+        self.assertEqual(len(sigs), 1)
+        self.assertEqual(sigs[0].fpr,
+                         'E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+
+    def test_argument_errors(self) -> None:
+        ctx = gpgme.Context()
+        fpr = 'E79A842DA34A1CA383F64A1546BB55F0885C65A4'
+        self.assertRaises(TypeError, ctx.get_key)
+        self.assertRaises(TypeError, ctx.get_key, fpr, False, None)
+        self.assertRaises(TypeError, ctx.get_key, fpr, fingerprint=fpr)
+        self.assertRaises(TypeError, ctx.get_key, fpr, unknown=1)
+        self.assertRaises(TypeError, ctx.get_key, 42)
+        self.assertRaises(ValueError, ctx.get_key, 'abc\0def')
+        self.assertRaises(TypeError, ctx.sign, BytesIO(), BytesIO(), 'x')
+        self.assertRaises(TypeError, ctx.keylist, None, False, True)
+
     def test_sign_normal(self) -> None:
         ctx = gpgme.Context()
         ctx.armor = False
@@ -359,3 +452,66 @@ class SignVerifyTestCase(GpgHomeTestCase):
         self.assertEqual(notations[2].name, 'unicode@example.com')
         self.assertEqual(notations[2].value, '\xa7v1')
         self.assertEqual(notations[2].flags, gpgme.SigNotationFlags.HUMAN_READABLE)
+
+    def test_verify_result_outlives_operation(self) -> None:
+        ctx = gpgme.Context()
+        key = ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        ctx.signers = [key]
+        ctx.sig_notations = [
+            gpgme.SigNotation('test@example.com', 'test value')]
+        signature = BytesIO()
+        ctx.sign(BytesIO(b'Hello World\n'), signature, gpgme.SigMode.NORMAL)
+        signature.seek(0)
+        sigs = ctx.verify(signature, None, BytesIO())
+        self.assertEqual(len(sigs), 1)
+
+        # Attributes are decoded on first access, so must not depend
+        # on the result of the context's last operation.
+        ctx.sign(BytesIO(b'Another message\n'), BytesIO(),
+                 gpgme.SigMode.NORMAL)
+        self.assertEqual(sigs[0].fpr,
+                         'E79A842DA34A1CA383F64A1546BB55F0885C65A4')
+        self.assertEqual(sigs[0].status, None)
+        self.assertEqual(len(sigs[0].notations), 1)
+        self.assertEqual(sigs[0].notations[0].name, 'test@example.com')
+        self.assertEqual(sigs[0].notations[0].value, 'test value')
+        self.assertIs(sigs[0].notations, sigs[0].notations)
+        self.assertIs(sigs[0].fpr, sigs[0].fpr)
+
+    def test_status_cb(self) -> None:
+        ctx = gpgme.Context()
+        ctx.signers = [ctx.get_key('E79A842DA34A1CA383F64A1546BB55F0885C65A4')]
+        signature = BytesIO()
+        ctx.sign(BytesIO(b'Hello World\n'), signature, gpgme.SigMode.NORMAL)
+
+        lines = []
+        ctx.set_status_cb(lambda status, args: lines.append((status, args)),
+                          [gpgme.Status.GOODSIG, gpgme.Status.VALIDSIG])
+        signature.seek(0)
+        ctx.verify(signature, None, BytesIO())
+        self.assertEqual(sorted(status for status, args in lines),
+                         [gpgme.Status.GOODSIG, gpgme.Status.VALIDSIG])
+        for status, args in lines:
+            self.assertIs(type(status), gpgme.Status)
+            assert args is not None
+            self.assertIn('46BB55F0885C65A4', args)
+
+        # lines left over when the call returns are flushed as a batch
+        batches = []
+        ctx.set_status_cb(batches.append, [gpgme.Status.GOODSIG,
+                                           gpgme.Status.VALIDSIG], batch=10)
+        signature.seek(0)
+        ctx.verify(signature, None, BytesIO())
+        self.assertEqual(len(batches), 1)
+        self.assertEqual(len(batches[0]), 2)
+
+        # a callback needs a non-empty list of statuses
+        self.assertRaises(TypeError, ctx.set_status_cb, print)
+        self.assertRaises(TypeError, ctx.set_status_cb, print, None)
+        self.assertRaises(ValueError, ctx.set_status_cb, print, [])
+
+        ctx.set_status_cb(None)
+        signature.seek(0)
+        ctx.verify(signature, None, BytesIO())
+        self.assertEqual(len(batches), 1)
+        self.assertRaises(ValueError, ctx.set_status_cb, print, [100000])